@@ -73,7 +73,7 @@ int main() try {
     fout.exceptions(std::ofstream::failbit);
     fout.open(output_file, std::ios::binary | std::ios::out);
 
-    fout.write(reinterpret_cast<char*>(img.bytes.data()), img.bytes.size());
+    fout.write(reinterpret_cast<const char*>(img.bytes.data()), img.bytes.size());
     fout.close();
 
     return EXIT_SUCCESS;
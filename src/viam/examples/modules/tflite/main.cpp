@@ -129,6 +129,10 @@ class MLModelServiceTFLite : public vsdk::MLModelService, public vsdk::Stoppable
             check_stopped_inlock_();
             swap(state_, state);
         }
+
+        // The new model may have different inputs and outputs, so
+        // tell anyone caching our metadata to fetch it again.
+        metadata_changed();
         state_ready_.notify_all();
     } catch (...) {
         // If reconfiguration fails for any reason, become stopped and rethrow.
@@ -460,6 +464,9 @@ class MLModelServiceTFLite : public vsdk::MLModelService, public vsdk::Stoppable
             }
             input_info.data_type =
                 service_data_type_from_tflite_data_type_(TfLiteTensorType(tensor));
+            // These are the dimensions of the allocated tensor, so the leading dimension is
+            // never -1 and `BatchingMLModelService` will not batch this model. The TFLite C API
+            // does not expose the tensor's shape signature.
             for (decltype(ndims) j = 0; j != ndims; ++j) {
                 input_info.shape.push_back(TfLiteTensorDim(tensor, j));
             }
@@ -0,0 +1,220 @@
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <google/protobuf/arena.h>
+#include <google/protobuf/struct.pb.h>
+
+#include <viam/sdk/benchmarks/harness.hpp>
+#include <viam/sdk/common/flat_proto_struct.hpp>
+#include <viam/sdk/common/proto_struct_view.hpp>
+#include <viam/sdk/common/proto_value.hpp>
+#include <viam/sdk/common/utils.hpp>
+#include <viam/sdk/components/camera.hpp>
+#include <viam/sdk/components/sensor.hpp>
+#include <viam/sdk/resource/resource_api.hpp>
+
+namespace {
+
+using namespace viam::sdk;
+
+// Shaped like the readings of a typical sensor: a few scalars, a nested pose and a batch of
+// samples.
+ProtoStruct make_readings() {
+    ProtoList samples;
+    for (int i = 0; i < 64; ++i) {
+        samples.emplace_back(i * 0.5);
+    }
+
+    return {{"temperature", 21.5},
+            {"humidity", 0.4},
+            {"status", "ok"},
+            {"calibrated", true},
+            {"pose", ProtoStruct{{"x", 1.0}, {"y", 2.0}, {"z", 3.0}, {"theta", 90.0}}},
+            {"samples", std::move(samples)}};
+}
+
+Camera::depth_map make_depth_map() {
+    Camera::depth_map map = Camera::depth_map::from_shape({480, 640});
+    for (std::size_t i = 0; i < map.size(); ++i) {
+        map.data()[i] = static_cast<std::uint16_t>(i);
+    }
+    return map;
+}
+
+std::vector<Name> make_names(std::size_t count) {
+    std::vector<Name> names;
+    names.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        names.emplace_back(API::get<Sensor>(), "", "sensor" + std::to_string(i));
+    }
+    return names;
+}
+
+}  // namespace
+
+VIAMSDK_BENCHMARK(proto_value_to_proto) {
+    const ProtoStruct readings = make_readings();
+    state.measure([&] {
+        const google::protobuf::Struct proto = to_proto(readings);
+        viam::sdkbench::do_not_optimize(proto);
+    });
+}
+
+VIAMSDK_BENCHMARK(proto_value_from_proto) {
+    const google::protobuf::Struct proto = to_proto(make_readings());
+    state.measure([&] {
+        const ProtoStruct readings = from_proto(proto);
+        viam::sdkbench::do_not_optimize(readings);
+    });
+}
+
+VIAMSDK_BENCHMARK(proto_value_to_proto_arena) {
+    const ProtoStruct readings = make_readings();
+    state.measure([&] {
+        google::protobuf::Arena arena;
+        viam::sdkbench::do_not_optimize(to_proto(readings, &arena));
+    });
+}
+
+// Includes the copy of the message being consumed, so compare against proto_value_from_proto plus
+// the cost of copying a Struct.
+VIAMSDK_BENCHMARK(proto_value_from_proto_move) {
+    const google::protobuf::Struct proto = to_proto(make_readings());
+    state.measure([&] {
+        google::protobuf::Struct consumed = proto;
+        const ProtoStruct readings = from_proto(std::move(consumed));
+        viam::sdkbench::do_not_optimize(readings);
+    });
+}
+
+VIAMSDK_BENCHMARK(proto_value_round_trip) {
+    const ProtoStruct readings = make_readings();
+    state.measure([&] {
+        const ProtoStruct result = from_proto(to_proto(readings));
+        viam::sdkbench::do_not_optimize(result);
+    });
+}
+
+// The same field-by-field construction a sensor's get_readings performs, into each container.
+VIAMSDK_BENCHMARK(proto_struct_build) {
+    state.measure([&] {
+        ProtoStruct readings;
+        readings.emplace("temperature", 21.5);
+        readings.emplace("humidity", 0.4);
+        readings.emplace("status", "ok");
+        readings.emplace("calibrated", true);
+        viam::sdkbench::do_not_optimize(readings);
+    });
+}
+
+VIAMSDK_BENCHMARK(flat_proto_struct_build) {
+    state.measure([&] {
+        FlatProtoStruct readings;
+        readings.emplace("temperature", 21.5);
+        readings.emplace("humidity", 0.4);
+        readings.emplace("status", "ok");
+        readings.emplace("calibrated", true);
+        viam::sdkbench::do_not_optimize(readings);
+    });
+}
+
+VIAMSDK_BENCHMARK(proto_struct_lookup) {
+    const ProtoStruct readings = make_readings();
+    const std::string key = "status";
+    state.measure([&] { viam::sdkbench::do_not_optimize(readings.find(key)); });
+}
+
+VIAMSDK_BENCHMARK(flat_proto_struct_lookup) {
+    const FlatProtoStruct readings(make_readings());
+    const std::string key = "status";
+    state.measure([&] { viam::sdkbench::do_not_optimize(readings.find(key)); });
+}
+
+VIAMSDK_BENCHMARK(flat_proto_struct_to_proto) {
+    const FlatProtoStruct readings(make_readings());
+    state.measure([&] {
+        const google::protobuf::Struct proto = to_proto(readings);
+        viam::sdkbench::do_not_optimize(proto);
+    });
+}
+
+// Reuses one FlatProtoStruct, the way a handler holding it across requests would.
+VIAMSDK_BENCHMARK(flat_proto_struct_assign) {
+    const google::protobuf::Struct proto = to_proto(make_readings());
+    FlatProtoStruct readings;
+    state.measure([&] {
+        readings.assign(proto);
+        viam::sdkbench::do_not_optimize(readings);
+    });
+}
+
+// What a capture-aware resource pays to check a request's extra for `fromDataManagement`, with and
+// without converting it first.
+VIAMSDK_BENCHMARK(from_dm_from_extra_convert) {
+    ProtoStruct extra = make_readings();
+    extra.emplace("fromDataManagement", true);
+    const google::protobuf::Struct proto = to_proto(extra);
+    state.measure([&] { viam::sdkbench::do_not_optimize(from_dm_from_extra(from_proto(proto))); });
+}
+
+VIAMSDK_BENCHMARK(from_dm_from_extra_view) {
+    ProtoStruct extra = make_readings();
+    extra.emplace("fromDataManagement", true);
+    const google::protobuf::Struct proto = to_proto(extra);
+    state.measure(
+        [&] { viam::sdkbench::do_not_optimize(from_dm_from_extra(ProtoStructView(proto))); });
+}
+
+VIAMSDK_BENCHMARK(depth_map_encode) {
+    const Camera::depth_map map = make_depth_map();
+    state.set_bytes_per_op(map.size() * sizeof(std::uint16_t));
+    state.measure([&] {
+        const std::vector<unsigned char> data = Camera::encode_depth_map(map);
+        viam::sdkbench::do_not_optimize(data);
+    });
+}
+
+VIAMSDK_BENCHMARK(depth_map_decode) {
+    const Camera::depth_map map = make_depth_map();
+    const std::vector<unsigned char> data = Camera::encode_depth_map(map);
+    state.set_bytes_per_op(map.size() * sizeof(std::uint16_t));
+    state.measure([&] {
+        const Camera::depth_map result = Camera::decode_depth_map(data);
+        viam::sdkbench::do_not_optimize(result);
+    });
+}
+
+VIAMSDK_BENCHMARK(depth_map_decode_into) {
+    const Camera::depth_map map = make_depth_map();
+    const std::vector<unsigned char> data = Camera::encode_depth_map(map);
+    Camera::depth_map result;
+    state.set_bytes_per_op(map.size() * sizeof(std::uint16_t));
+    state.measure([&] {
+        Camera::decode_depth_map(data.data(), data.size(), result);
+        viam::sdkbench::do_not_optimize(result);
+    });
+}
+
+VIAMSDK_BENCHMARK(name_hash) {
+    const Name name(API::get<Sensor>(), "remote", "sensor0");
+    const std::hash<Name> hasher;
+    state.measure([&] { viam::sdkbench::do_not_optimize(hasher(name)); });
+}
+
+VIAMSDK_BENCHMARK(name_map_lookup) {
+    const std::vector<Name> names = make_names(256);
+    std::unordered_map<Name, std::size_t> map;
+    for (std::size_t i = 0; i < names.size(); ++i) {
+        map.emplace(names[i], i);
+    }
+
+    // Look up keys which are equal to, but not the same objects as, the stored ones.
+    const std::vector<Name> keys = make_names(256);
+    std::size_t i = 0;
+    state.measure([&] {
+        viam::sdkbench::do_not_optimize(map.find(keys[i++ % keys.size()]));
+    });
+}
@@ -0,0 +1,120 @@
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <boost/mpl/for_each.hpp>
+
+#include <viam/sdk/benchmarks/harness.hpp>
+#include <viam/sdk/services/mlmodel.hpp>
+#include <viam/sdk/services/private/mlmodel.hpp>
+
+namespace {
+
+using namespace viam::sdk;
+using ::viam::service::mlmodel::v1::FlatTensor;
+
+// The size of a typical image classifier input: 224x224 pixels with three channels.
+const std::vector<std::size_t> k_shape = {1, 224, 224, 3};
+constexpr std::size_t k_elements = 224 * 224 * 3;
+
+template <typename T>
+const char* dtype_name();
+
+template <>
+const char* dtype_name<std::int8_t>() {
+    return "int8";
+}
+template <>
+const char* dtype_name<std::uint8_t>() {
+    return "uint8";
+}
+template <>
+const char* dtype_name<std::int16_t>() {
+    return "int16";
+}
+template <>
+const char* dtype_name<std::uint16_t>() {
+    return "uint16";
+}
+template <>
+const char* dtype_name<std::int32_t>() {
+    return "int32";
+}
+template <>
+const char* dtype_name<std::uint32_t>() {
+    return "uint32";
+}
+template <>
+const char* dtype_name<std::int64_t>() {
+    return "int64";
+}
+template <>
+const char* dtype_name<std::uint64_t>() {
+    return "uint64";
+}
+template <>
+const char* dtype_name<float>() {
+    return "float32";
+}
+template <>
+const char* dtype_name<double>() {
+    return "float64";
+}
+
+template <typename T>
+std::vector<T> make_data() {
+    std::vector<T> data(k_elements);
+    for (std::size_t i = 0; i < data.size(); ++i) {
+        data[i] = static_cast<T>(i % 100);
+    }
+    return data;
+}
+
+template <typename T>
+void sdk_to_api(viam::sdkbench::State& state) {
+    const std::vector<T> data = make_data<T>();
+    const MLModelService::tensor_views view =
+        MLModelService::make_tensor_view(data.data(), data.size(), k_shape);
+
+    state.set_bytes_per_op(data.size() * sizeof(T));
+    state.measure([&] {
+        FlatTensor target;
+        impl::mlmodel::copy_sdk_tensor_to_api_tensor(view, &target);
+        viam::sdkbench::do_not_optimize(target);
+    });
+}
+
+template <typename T>
+void api_to_sdk(viam::sdkbench::State& state) {
+    const std::vector<T> data = make_data<T>();
+    FlatTensor source;
+    impl::mlmodel::copy_sdk_tensor_to_api_tensor(
+        MLModelService::make_tensor_view(data.data(), data.size(), k_shape), &source);
+
+    state.set_bytes_per_op(data.size() * sizeof(T));
+    state.measure([&] {
+        impl::mlmodel::tensor_storage storage;
+        const MLModelService::tensor_views view =
+            impl::mlmodel::make_sdk_tensor_from_api_tensor(source, &storage);
+        viam::sdkbench::do_not_optimize(view);
+    });
+}
+
+struct register_for_type {
+    template <typename T>
+    void operator()(T) const {
+        const std::string suffix = std::string("/") + dtype_name<T>();
+        viam::sdkbench::register_benchmark("mlmodel_copy_sdk_tensor_to_api_tensor" + suffix,
+                                           &sdk_to_api<T>);
+        viam::sdkbench::register_benchmark("mlmodel_make_sdk_tensor_from_api_tensor" + suffix,
+                                           &api_to_sdk<T>);
+    }
+};
+
+const bool registered = [] {
+    boost::mpl::for_each<MLModelService::base_types>(register_for_type{});
+    return true;
+}();
+
+}  // namespace
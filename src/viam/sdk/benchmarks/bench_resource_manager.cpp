@@ -0,0 +1,44 @@
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <viam/sdk/benchmarks/harness.hpp>
+#include <viam/sdk/components/sensor.hpp>
+#include <viam/sdk/resource/resource_manager.hpp>
+#include <viam/sdk/tests/mocks/mock_sensor.hpp>
+
+namespace {
+
+using namespace viam::sdk;
+using viam::sdktests::sensor::MockSensor;
+
+constexpr std::size_t k_resource_count = 64;
+
+// Looks up sensors by name the way the resource servers do, from several threads at once.
+void resource_lookup(viam::sdkbench::State& state, std::size_t threads) {
+    auto manager = std::make_shared<ResourceManager>();
+
+    std::vector<std::string> names;
+    for (std::size_t i = 0; i < k_resource_count; ++i) {
+        names.push_back("sensor" + std::to_string(i));
+        manager->add(Name(API::get<Sensor>(), "", names.back()),
+                     std::make_shared<MockSensor>(names.back()));
+    }
+
+    state.measure_concurrent(threads, [&](std::size_t thread) {
+        viam::sdkbench::do_not_optimize(
+            manager->resource<Sensor>(names[(thread * 7) % names.size()]));
+    });
+}
+
+const bool registered = [] {
+    for (const std::size_t threads : {1, 2, 4, 8}) {
+        viam::sdkbench::register_benchmark(
+            "resource_manager_lookup/threads:" + std::to_string(threads),
+            [threads](viam::sdkbench::State& state) { resource_lookup(state, threads); });
+    }
+    return true;
+}();
+
+}  // namespace
@@ -0,0 +1,173 @@
+// Full client to server round trips over an in-process gRPC channel, served by the test mocks.
+
+#include <cstddef>
+#include <cstdint>
+#include <future>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <viam/sdk/benchmarks/harness.hpp>
+#include <viam/sdk/common/audio.hpp>
+#include <viam/sdk/components/audio_in.hpp>
+#include <viam/sdk/components/camera.hpp>
+#include <viam/sdk/components/motor.hpp>
+#include <viam/sdk/components/sensor.hpp>
+#include <viam/sdk/services/mlmodel.hpp>
+#include <viam/sdk/tests/mocks/camera_mocks.hpp>
+#include <viam/sdk/tests/mocks/mlmodel_mocks.hpp>
+#include <viam/sdk/tests/mocks/mock_audio_in.hpp>
+#include <viam/sdk/tests/mocks/mock_motor.hpp>
+#include <viam/sdk/tests/mocks/mock_sensor.hpp>
+#include <viam/sdk/tests/test_utils.hpp>
+
+namespace {
+
+using namespace viam::sdk;
+using namespace viam::sdktests;
+
+// A mock camera whose frames are the size of an uncompressed 640x480 RGB image.
+class VGACamera : public camera::MockCamera {
+   public:
+    static constexpr std::size_t k_frame_bytes = 640 * 480 * 3;
+
+    VGACamera() : MockCamera("vga_camera") {
+        raw_image image;
+        image.mime_type = "image/vnd.viam.rgba";
+        image.source_name = "color";
+        image.bytes = std::vector<unsigned char>(k_frame_bytes, 0x7f);
+        images_.images.push_back(std::move(image));
+        images_.metadata.captured_at = time_pt{std::chrono::seconds(1)};
+    }
+
+    image_collection get_images(std::vector<std::string>, const ProtoStruct&) override {
+        return images_;
+    }
+
+   private:
+    image_collection images_;
+};
+
+// A mock microphone which produces 10ms chunks of 4-channel, 48kHz PCM16 audio as fast as they are
+// consumed, refilling one chunk rather than building a new one each time.
+class StreamingAudioIn : public audioin::MockAudioIn {
+   public:
+    static constexpr int k_sample_rate_hz = 48000;
+    static constexpr int k_channels = 4;
+    static constexpr std::size_t k_chunk_bytes = k_sample_rate_hz / 100 * k_channels * 2;
+    static constexpr int k_chunks_per_call = 100;
+
+    StreamingAudioIn() : MockAudioIn("streaming_audio_in") {}
+
+    void get_audio(std::string const& codec,
+                   std::function<bool(audio_chunk&& chunk)> const& chunk_handler,
+                   double const&,
+                   int64_t const&,
+                   const ProtoStruct&) override {
+        audio_chunk chunk;
+        chunk.audio_data.assign(k_chunk_bytes, 0x11);
+        chunk.info = {codec, k_sample_rate_hz, k_channels};
+        for (int i = 0; i < k_chunks_per_call; ++i) {
+            chunk.sequence_number = i;
+            chunk.start_timestamp_ns = std::chrono::milliseconds(10 * i);
+            chunk.end_timestamp_ns = std::chrono::milliseconds(10 * (i + 1));
+            if (!chunk_handler(std::move(chunk))) {
+                return;
+            }
+        }
+    }
+};
+
+}  // namespace
+
+VIAMSDK_BENCHMARK(rpc_camera_get_images) {
+    client_to_mock_pipeline<Camera>(camera::MockCamera::get_mock_camera(), [&](Camera& client) {
+        state.measure([&] { viam::sdkbench::do_not_optimize(client.get_images()); });
+    });
+}
+
+VIAMSDK_BENCHMARK(rpc_camera_get_images_vga) {
+    state.set_bytes_per_op(VGACamera::k_frame_bytes);
+    client_to_mock_pipeline<Camera>(std::make_shared<VGACamera>(), [&](Camera& client) {
+        state.measure([&] { viam::sdkbench::do_not_optimize(client.get_images()); });
+    });
+}
+
+// A small, high frequency call, which is dominated by per-call overhead rather than payload.
+VIAMSDK_BENCHMARK(rpc_motor_get_position) {
+    client_to_mock_pipeline<Motor>(motor::MockMotor::get_mock_motor(), [&](Motor& client) {
+        state.measure([&] { viam::sdkbench::do_not_optimize(client.get_position()); });
+    });
+}
+
+VIAMSDK_BENCHMARK(rpc_sensor_get_readings) {
+    client_to_mock_pipeline<Sensor>(sensor::MockSensor::get_mock_sensor(), [&](Sensor& client) {
+        state.measure([&] { viam::sdkbench::do_not_optimize(client.get_readings()); });
+    });
+}
+
+// Reading a dozen sensors at once, as a data capture loop would. Compare with the sequential
+// version below to see how much of the per-call latency the async API overlaps.
+VIAMSDK_BENCHMARK(rpc_sensor_get_readings_async_x12) {
+    client_to_mock_pipeline<Sensor>(sensor::MockSensor::get_mock_sensor(), [&](Sensor& client) {
+        std::vector<std::future<ProtoStruct>> pending(12);
+        state.measure([&] {
+            for (auto& readings : pending) {
+                readings = client.get_readings_async();
+            }
+            for (auto& readings : pending) {
+                viam::sdkbench::do_not_optimize(readings.get());
+            }
+        });
+    });
+}
+
+VIAMSDK_BENCHMARK(rpc_sensor_get_readings_x12) {
+    client_to_mock_pipeline<Sensor>(sensor::MockSensor::get_mock_sensor(), [&](Sensor& client) {
+        state.measure([&] {
+            for (int i = 0; i < 12; ++i) {
+                viam::sdkbench::do_not_optimize(client.get_readings());
+            }
+        });
+    });
+}
+
+VIAMSDK_BENCHMARK(rpc_mlmodel_infer) {
+    const std::vector<std::size_t> shape = {1, 224, 224, 3};
+    const std::vector<float> input(224 * 224 * 3, 0.5F);
+
+    const struct MLModelService::tensor_info info {
+        "x", "", MLModelService::tensor_info::data_types::k_float32, {1, 224, 224, 3}, {}, {}
+    };
+
+    auto mock = std::make_shared<MockMLModelService>();
+    mock->set_metadata({"echo", "", "", {info}, {info}});
+    mock->set_infer_handler([](const MLModelService::named_tensor_views& request) {
+        return std::make_shared<MLModelService::named_tensor_views>(request);
+    });
+
+    state.set_bytes_per_op(input.size() * sizeof(float));
+    client_to_mock_pipeline<MLModelService>(mock, [&](MLModelService& client) {
+        MLModelService::named_tensor_views request;
+        request.emplace("x", MLModelService::make_tensor_view(input.data(), input.size(), shape));
+        state.measure([&] { viam::sdkbench::do_not_optimize(client.infer(request)); });
+    });
+}
+
+// Each operation streams `StreamingAudioIn::k_chunks_per_call` chunks, so divide by that for the
+// cost of one chunk.
+VIAMSDK_BENCHMARK(rpc_audio_in_get_audio_100_chunks) {
+    state.set_bytes_per_op(StreamingAudioIn::k_chunk_bytes * StreamingAudioIn::k_chunks_per_call);
+    client_to_mock_pipeline<AudioIn>(std::make_shared<StreamingAudioIn>(), [&](AudioIn& client) {
+        state.measure([&] {
+            client.get_audio(
+                audio_codecs::PCM_16,
+                [](AudioIn::audio_chunk&& chunk) {
+                    viam::sdkbench::do_not_optimize(chunk.audio_data.data());
+                    return true;
+                },
+                0,
+                0);
+        });
+    });
+}
@@ -0,0 +1,37 @@
+// The cost ServerSpanGuard adds to every served RPC. Unless the SDK is built with
+// VIAMCPPSDK_OPENTELEMETRY_TRACING the guard is a no-op and both benchmarks measure nothing.
+// Otherwise, run with OTEL_TRACES_SAMPLER or VIAM_MODULE_TRACING_METHOD_RATE_LIMIT set to see the
+// cost of spans which sampling drops.
+
+#include <grpcpp/server_context.h>
+
+#include <viam/sdk/benchmarks/harness.hpp>
+#include <viam/sdk/tracing/private/span_guard.hpp>
+#include <viam/sdk/tracing/private/tracer.hpp>
+
+namespace {
+
+using viam::sdk::impl::ServerSpanGuard;
+using viam::sdk::impl::Tracer;
+
+void serve_one(const grpc::ServerContext& context) {
+    ServerSpanGuard guard{&context, "MotorServer::GetPosition"};
+    viam::sdkbench::do_not_optimize(guard.commit(grpc::Status::OK));
+}
+
+}  // namespace
+
+// No tracer provider is installed, as in a module run without tracing.
+VIAMSDK_BENCHMARK(tracing_server_span_guard_disabled) {
+    Tracer::get().shutdown_provider();
+    const grpc::ServerContext context;
+    state.measure([&] { serve_one(context); });
+}
+
+// Spans are recorded and encoded for export, then discarded rather than sent to a parent.
+VIAMSDK_BENCHMARK(tracing_server_span_guard_enabled) {
+    Tracer::get().initialize_discarding_provider();
+    const grpc::ServerContext context;
+    state.measure([&] { serve_one(context); });
+    Tracer::get().shutdown_provider();
+}
@@ -0,0 +1,219 @@
+#include <viam/sdk/benchmarks/harness.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <ctime>
+#include <exception>
+#include <iomanip>
+#include <iostream>
+#include <numeric>
+#include <sstream>
+#include <stdexcept>
+#include <utility>
+
+#include <viam/sdk/common/version_metadata.hpp>
+
+namespace viam {
+namespace sdkbench {
+
+namespace {
+
+struct registration {
+    std::string name;
+    benchmark_fn fn;
+};
+
+// Benchmarks register themselves during static initialization, so the registry is created on
+// first use rather than being a namespace-scope object.
+std::vector<registration>& registry() {
+    static std::vector<registration> benchmarks;
+    return benchmarks;
+}
+
+std::vector<registration> sorted_registry() {
+    auto benchmarks = registry();
+    std::sort(benchmarks.begin(), benchmarks.end(), [](const auto& lhs, const auto& rhs) {
+        return lhs.name < rhs.name;
+    });
+    return benchmarks;
+}
+
+std::string json_escape(const std::string& str) {
+    std::ostringstream out;
+    for (const char c : str) {
+        switch (c) {
+            case '"':
+                out << "\\\"";
+                break;
+            case '\\':
+                out << "\\\\";
+                break;
+            case '\n':
+                out << "\\n";
+                break;
+            case '\t':
+                out << "\\t";
+                break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20) {
+                    out << "\\u" << std::hex << std::setw(4) << std::setfill('0')
+                        << static_cast<int>(c) << std::dec;
+                } else {
+                    out << c;
+                }
+        }
+    }
+    return out.str();
+}
+
+double median(std::vector<double> samples) {
+    std::sort(samples.begin(), samples.end());
+    const std::size_t mid = samples.size() / 2;
+    return samples.size() % 2 ? samples[mid] : (samples[mid - 1] + samples[mid]) / 2;
+}
+
+std::string utc_now() {
+    const std::time_t now = std::time(nullptr);
+    char buf[32];
+    std::strftime(buf, sizeof(buf), "%Y-%m-%dT%H:%M:%SZ", std::gmtime(&now));
+    return buf;
+}
+
+}  // namespace
+
+State::State(std::string name, const run_config& config) : config_(config) {
+    result_.name = std::move(name);
+}
+
+void State::measure_(std::size_t threads, const batch_fn& batch) {
+    if (!result_.ns_per_op.empty()) {
+        throw std::logic_error("benchmark " + result_.name + " called measure more than once");
+    }
+    result_.threads = threads;
+
+    // Grow the iteration count until one batch takes at least the minimum time. The calibration
+    // batches double as a warm-up.
+    constexpr std::size_t max_iterations = std::size_t{1} << 30;
+    std::size_t iterations = 1;
+    while (true) {
+        const auto elapsed = batch(iterations);
+        if (elapsed >= config_.min_time || iterations >= max_iterations) {
+            break;
+        }
+
+        double factor = 10;
+        if (elapsed.count() > 0) {
+            factor = 1.2 * static_cast<double>(config_.min_time.count()) /
+                     static_cast<double>(elapsed.count());
+        }
+        factor = std::min(std::max(factor, 2.0), 10.0);
+        iterations = std::min(
+            max_iterations,
+            static_cast<std::size_t>(std::ceil(static_cast<double>(iterations) * factor)));
+    }
+    result_.iterations = iterations;
+
+    for (std::size_t rep = 0; rep < config_.repetitions; ++rep) {
+        const auto elapsed = batch(iterations);
+        result_.ns_per_op.push_back(static_cast<double>(elapsed.count()) /
+                                    static_cast<double>(iterations));
+    }
+}
+
+void register_benchmark(std::string name, benchmark_fn fn) {
+    registry().push_back({std::move(name), std::move(fn)});
+}
+
+std::vector<std::string> benchmark_names() {
+    std::vector<std::string> names;
+    for (const auto& benchmark : sorted_registry()) {
+        names.push_back(benchmark.name);
+    }
+    return names;
+}
+
+std::vector<result> run_benchmarks(const std::string& filter, const run_config& config) {
+    std::vector<result> results;
+    for (const auto& benchmark : sorted_registry()) {
+        if (benchmark.name.find(filter) == std::string::npos) {
+            continue;
+        }
+
+        State state(benchmark.name, config);
+        try {
+            benchmark.fn(state);
+            if (state.get_result().ns_per_op.empty()) {
+                throw std::logic_error("benchmark did not call measure");
+            }
+        } catch (const std::exception& e) {
+            results.push_back(state.get_result());
+            results.back().ns_per_op.clear();
+            results.back().error = e.what();
+            std::cerr << std::left << std::setw(56) << benchmark.name << " FAILED: " << e.what()
+                      << std::endl;
+            continue;
+        }
+
+        results.push_back(state.get_result());
+        std::cerr << std::left << std::setw(56) << benchmark.name << std::right << std::fixed
+                  << std::setprecision(1) << std::setw(14) << median(results.back().ns_per_op)
+                  << " ns/op" << std::endl;
+    }
+    return results;
+}
+
+void write_json(std::ostream& out, const std::vector<result>& results, const run_config& config) {
+    out << "{\n";
+    out << "  \"context\": {\n";
+    out << "    \"date\": \"" << utc_now() << "\",\n";
+    out << "    \"sdk_version\": \"" << json_escape(sdk::sdk_version()) << "\",\n";
+    out << "    \"host_threads\": " << std::thread::hardware_concurrency() << ",\n";
+#ifdef NDEBUG
+    out << "    \"assertions\": false,\n";
+#else
+    out << "    \"assertions\": true,\n";
+#endif
+    out << "    \"min_time_ns\": " << config.min_time.count() << ",\n";
+    out << "    \"repetitions\": " << config.repetitions << "\n";
+    out << "  },\n";
+    out << "  \"benchmarks\": [";
+
+    const char* separator = "\n";
+    for (const auto& r : results) {
+        out << separator << "    {\n";
+        separator = ",\n";
+
+        out << "      \"name\": \"" << json_escape(r.name) << "\",\n";
+        out << "      \"threads\": " << r.threads;
+        if (!r.error.empty()) {
+            out << ",\n      \"error\": \"" << json_escape(r.error) << "\"\n    }";
+            continue;
+        }
+
+        const double med = median(r.ns_per_op);
+        const double mean =
+            std::accumulate(r.ns_per_op.begin(), r.ns_per_op.end(), 0.0) / r.ns_per_op.size();
+        const auto minmax = std::minmax_element(r.ns_per_op.begin(), r.ns_per_op.end());
+
+        out << ",\n      \"iterations\": " << r.iterations << ",\n";
+        out << "      \"repetitions\": " << r.ns_per_op.size() << ",\n";
+        out << std::fixed << std::setprecision(3);
+        out << "      \"ns_per_op\": {\"min\": " << *minmax.first << ", \"median\": " << med
+            << ", \"mean\": " << mean << ", \"max\": " << *minmax.second << "},\n";
+        out << "      \"ns_per_op_samples\": [";
+        for (std::size_t i = 0; i < r.ns_per_op.size(); ++i) {
+            out << (i ? ", " : "") << r.ns_per_op[i];
+        }
+        out << "]";
+        if (r.bytes_per_op > 0) {
+            out << ",\n      \"bytes_per_op\": " << r.bytes_per_op << ",\n";
+            out << "      \"bytes_per_second\": "
+                << static_cast<double>(r.bytes_per_op) * 1e9 / med * r.threads;
+        }
+        out << "\n    }";
+    }
+    out << "\n  ]\n}\n";
+}
+
+}  // namespace sdkbench
+}  // namespace viam
@@ -0,0 +1,142 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iosfwd>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace viam {
+namespace sdkbench {
+
+// Keeps the compiler from discarding a value which a benchmark computes but never uses.
+template <typename T>
+inline void do_not_optimize(const T& value) {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    static const volatile void* sink;
+    sink = &value;
+#endif
+}
+
+struct run_config {
+    std::chrono::nanoseconds min_time{std::chrono::milliseconds(200)};
+    std::size_t repetitions = 5;
+};
+
+// The measurements taken for one benchmark.
+struct result {
+    std::string name;
+    std::size_t threads = 1;
+
+    // Operations run by each thread in each repetition.
+    std::uint64_t iterations = 0;
+
+    // Wall-clock nanoseconds per operation, one entry per repetition.
+    std::vector<double> ns_per_op;
+
+    // Payload bytes moved by each operation, if the benchmark reported it.
+    std::uint64_t bytes_per_op = 0;
+
+    // Set instead of the measurements if the benchmark threw.
+    std::string error;
+};
+
+// Handed to each benchmark, which does its setup and then calls `measure` exactly once with the
+// operation to time.
+class State {
+   public:
+    State(std::string name, const run_config& config);
+
+    // Times `op`. The iteration count is chosen so that each repetition runs for at least the
+    // configured minimum time.
+    template <typename Op>
+    void measure(Op&& op) {
+        measure_(1, [&op](std::size_t iterations) {
+            const auto start = std::chrono::steady_clock::now();
+            for (std::size_t i = 0; i < iterations; ++i) {
+                op();
+            }
+            return std::chrono::steady_clock::now() - start;
+        });
+    }
+
+    // Times `op(thread_index)` running concurrently on `threads` threads. The reported time per
+    // operation is the wall-clock time for each thread to complete its iterations, divided by the
+    // iteration count.
+    template <typename Op>
+    void measure_concurrent(std::size_t threads, Op&& op) {
+        measure_(threads, [threads, &op](std::size_t iterations) {
+            std::atomic<bool> go{false};
+            std::vector<std::thread> workers;
+            workers.reserve(threads);
+            for (std::size_t t = 0; t < threads; ++t) {
+                workers.emplace_back([&go, &op, t, iterations] {
+                    while (!go.load(std::memory_order_acquire)) {
+                        std::this_thread::yield();
+                    }
+                    for (std::size_t i = 0; i < iterations; ++i) {
+                        op(t);
+                    }
+                });
+            }
+
+            const auto start = std::chrono::steady_clock::now();
+            go.store(true, std::memory_order_release);
+            for (auto& worker : workers) {
+                worker.join();
+            }
+            return std::chrono::steady_clock::now() - start;
+        });
+    }
+
+    // Reports how many payload bytes each operation moves, so that throughput can be derived.
+    void set_bytes_per_op(std::uint64_t bytes) {
+        result_.bytes_per_op = bytes;
+    }
+
+    const result& get_result() const {
+        return result_;
+    }
+
+   private:
+    using batch_fn = std::function<std::chrono::nanoseconds(std::size_t iterations)>;
+
+    void measure_(std::size_t threads, const batch_fn& batch);
+
+    run_config config_;
+    result result_;
+};
+
+using benchmark_fn = std::function<void(State&)>;
+
+void register_benchmark(std::string name, benchmark_fn fn);
+
+struct registrar {
+    registrar(const char* name, void (*fn)(State&)) {
+        register_benchmark(name, fn);
+    }
+};
+
+// Runs every registered benchmark whose name contains `filter`, reporting progress on stderr.
+std::vector<result> run_benchmarks(const std::string& filter, const run_config& config);
+
+// Lists the names of the registered benchmarks.
+std::vector<std::string> benchmark_names();
+
+// Writes `results` as a JSON document.
+void write_json(std::ostream& out, const std::vector<result>& results, const run_config& config);
+
+}  // namespace sdkbench
+}  // namespace viam
+
+// Defines and registers a benchmark. The body receives a `State& state`.
+#define VIAMSDK_BENCHMARK(NAME)                                                         \
+    static void NAME(::viam::sdkbench::State& state);                                   \
+    static const ::viam::sdkbench::registrar NAME##_registrar(#NAME, &NAME); /* NOLINT */ \
+    static void NAME(::viam::sdkbench::State& state)
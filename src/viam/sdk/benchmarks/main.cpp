@@ -0,0 +1,91 @@
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+
+#include <viam/sdk/benchmarks/harness.hpp>
+#include <viam/sdk/common/instance.hpp>
+#include <viam/sdk/log/logging.hpp>
+
+namespace {
+
+constexpr const char* k_usage =
+    "usage: viamsdk_benchmarks [--filter=SUBSTRING] [--min-time=SECONDS] [--repetitions=N]\n"
+    "                          [--out=FILE] [--list]\n"
+    "\n"
+    "Runs the SDK microbenchmarks and writes the results as JSON to FILE, or to stdout.\n";
+
+bool starts_with(const std::string& str, const std::string& prefix) {
+    return str.compare(0, prefix.size(), prefix) == 0;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    using namespace viam;
+
+    sdkbench::run_config config;
+    std::string filter;
+    std::string out_path;
+    bool list = false;
+
+    try {
+        for (int i = 1; i < argc; ++i) {
+            const std::string arg = argv[i];
+            if (starts_with(arg, "--filter=")) {
+                filter = arg.substr(9);
+            } else if (starts_with(arg, "--min-time=")) {
+                config.min_time = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    std::chrono::duration<double>(std::stod(arg.substr(11))));
+            } else if (starts_with(arg, "--repetitions=")) {
+                config.repetitions = std::stoul(arg.substr(14));
+            } else if (starts_with(arg, "--out=")) {
+                out_path = arg.substr(6);
+            } else if (arg == "--list") {
+                list = true;
+            } else {
+                std::cerr << k_usage;
+                return arg == "--help" ? EXIT_SUCCESS : EXIT_FAILURE;
+            }
+        }
+    } catch (const std::exception&) {
+        std::cerr << k_usage;
+        return EXIT_FAILURE;
+    }
+
+    if (list) {
+        for (const auto& name : sdkbench::benchmark_names()) {
+            std::cout << name << "\n";
+        }
+        return EXIT_SUCCESS;
+    }
+
+    if (config.repetitions == 0) {
+        config.repetitions = 1;
+    }
+
+    const sdk::Instance instance;
+
+    // Logging from the in-process servers would otherwise interleave with the results.
+    sdk::LogManager::get().set_global_log_level(sdk::log_level::error);
+
+    const auto results = sdkbench::run_benchmarks(filter, config);
+
+    if (out_path.empty()) {
+        sdkbench::write_json(std::cout, results, config);
+    } else {
+        std::ofstream out(out_path);
+        if (!out) {
+            std::cerr << "Unable to open " << out_path << " for writing\n";
+            return EXIT_FAILURE;
+        }
+        sdkbench::write_json(out, results, config);
+    }
+
+    for (const auto& result : results) {
+        if (!result.error.empty()) {
+            return EXIT_FAILURE;
+        }
+    }
+    return EXIT_SUCCESS;
+}
@@ -1,13 +1,18 @@
 #include <viam/sdk/common/client_helper.hpp>
 
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
 #include <cstdlib>
 
+#include <google/protobuf/arena.h>
 #include <grpcpp/client_context.h>
 #include <grpcpp/support/status.h>
 
 #include <viam/sdk/common/private/utils.hpp>
 #include <viam/sdk/common/private/version_metadata.hpp>
 #include <viam/sdk/log/logging.hpp>
+#include <viam/sdk/rpc/private/executor.hpp>
 #include <viam/sdk/tracing/private/span_guard.hpp>
 
 namespace viam {
@@ -36,11 +41,106 @@ boost::optional<std::string> debug_map_value(const ProtoStruct& extra) {
     return {};
 }
 
+void post_blocking_call(std::function<void()> call) {
+    // One worker per hardware thread. This is only used without the gRPC callback API, where each
+    // in-flight call occupies a thread for its whole duration.
+    static impl::Executor executor(0);
+    executor.post(std::move(call));
+}
+
+namespace {
+
+thread_local const CallScope* current_call_scope = nullptr;
+
+}  // namespace
+
+CallScope::CallScope(std::chrono::system_clock::time_point deadline,
+                     std::function<void()> on_async_complete)
+    : deadline_(deadline),
+      on_async_complete_(std::move(on_async_complete)),
+      previous_(current_call_scope) {
+    if (previous_) {
+        deadline_ = std::min(deadline_, previous_->deadline_);
+    }
+    current_call_scope = this;
+}
+
+CallScope::~CallScope() {
+    assert(current_call_scope == this);
+    current_call_scope = previous_;
+}
+
+const CallScope* CallScope::current() noexcept {
+    return current_call_scope;
+}
+
+std::chrono::system_clock::time_point CallScope::deadline() const noexcept {
+    return deadline_;
+}
+
+const std::function<void()>& CallScope::on_async_complete() const noexcept {
+    return on_async_complete_;
+}
+
+namespace {
+
+// Enough for the request and response of the small, high frequency calls such as
+// `Motor::get_position`, so that once the thread has made one call they don't allocate at all.
+constexpr std::size_t k_call_arena_initial_block_size = 4096;
+
+}  // namespace
+
+struct CallArena::state {
+    state() : arena(options(initial_block)) {}
+
+    static ::google::protobuf::ArenaOptions options(char* block) {
+        ::google::protobuf::ArenaOptions result;
+        result.initial_block = block;
+        result.initial_block_size = k_call_arena_initial_block_size;
+        return result;
+    }
+
+    static state& current() {
+        static thread_local state s;
+        return s;
+    }
+
+    // Reset keeps the initial block, but frees any blocks which a large call added after it.
+    alignas(std::max_align_t) char initial_block[k_call_arena_initial_block_size];
+    ::google::protobuf::Arena arena;
+    std::size_t users = 0;
+};
+
+CallArena::CallArena() : state_(&state::current()) {
+    ++state_->users;
+}
+
+CallArena::CallArena(CallArena&& other) noexcept : state_(other.state_) {
+    other.state_ = nullptr;
+}
+
+CallArena::~CallArena() {
+    if (!state_) {
+        return;
+    }
+    assert(state_ == &state::current());
+    if (--state_->users == 0) {
+        state_->arena.Reset();
+    }
+}
+
+::google::protobuf::Arena* CallArena::get() const noexcept {
+    return &state_->arena;
+}
+
 }  // namespace client_helper_details
 
 ClientContext::ClientContext() : wrapped_context_(std::make_unique<GrpcClientContext>()) {
     set_client_ctx_authority_();
     add_viam_client_version_();
+    if (const auto* scope = client_helper_details::CallScope::current()) {
+        wrapped_context_->set_deadline(scope->deadline());
+    }
 }
 
 ClientContext::ClientContext(const ViamChannel& channel) : ClientContext() {
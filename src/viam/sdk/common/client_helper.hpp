@@ -1,5 +1,12 @@
 #pragma once
 
+#include <chrono>
+#include <functional>
+#include <future>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
 #include <boost/optional.hpp>
 
 #include <viam/sdk/common/exception.hpp>
@@ -7,6 +14,14 @@
 #include <viam/sdk/common/proto_value.hpp>
 #include <viam/sdk/rpc/dial.hpp>
 
+namespace google {
+namespace protobuf {
+
+class Arena;
+
+}  // namespace protobuf
+}  // namespace google
+
 namespace viam {
 namespace sdk {
 
@@ -32,6 +47,96 @@ void set_name(...);
 
 boost::optional<std::string> debug_map_value(const ProtoStruct& extra);
 
+// Runs `call` on a pool of threads shared by all clients. Used by ClientHelper::invoke_async for
+// stubs which don't provide the gRPC callback API, and for RobotClient keepalives and reconnects.
+void post_blocking_call(std::function<void()> call);
+
+// Settings for the calls made on this thread while a CallScope is alive. This lets code which drives
+// resources through their public interfaces, such as RobotClient's fan-out reads, bound and observe
+// the calls those resources make. Scopes nest, and a nested scope never extends the deadline of the
+// scope enclosing it.
+class CallScope {
+   public:
+    CallScope(std::chrono::system_clock::time_point deadline,
+              std::function<void()> on_async_complete);
+    CallScope(const CallScope&) = delete;
+    CallScope& operator=(const CallScope&) = delete;
+    ~CallScope();
+
+    // The innermost scope on this thread, or null if there is none.
+    static const CallScope* current() noexcept;
+
+    // Applied to every ClientContext created in the scope.
+    std::chrono::system_clock::time_point deadline() const noexcept;
+
+    // Called, on whichever thread completes it, after each invoke_async call started in the scope
+    // has made its future ready.
+    const std::function<void()>& on_async_complete() const noexcept;
+
+   private:
+    std::chrono::system_clock::time_point deadline_;
+    std::function<void()> on_async_complete_;
+    const CallScope* previous_;
+};
+
+// A handle on the calling thread's arena for the messages of unary calls. The arena is reset when
+// the last handle on the thread is destroyed, so a call made from within the response handler of
+// another shares its arena, and a thread making one call at a time reuses the same memory for
+// every call. A CallArena must be destroyed on the thread which created it.
+class CallArena {
+   public:
+    CallArena();
+    CallArena(CallArena&& other) noexcept;
+    CallArena& operator=(CallArena&&) = delete;
+    ~CallArena();
+
+    ::google::protobuf::Arena* get() const noexcept;
+
+   private:
+    struct state;
+    state* state_;
+};
+
+// Request and response messages owned by the ClientHelper, for streaming calls whose response is
+// read repeatedly over a long lifetime.
+template <typename RequestType, typename ResponseType>
+class HeapMessages {
+   public:
+    RequestType& request() noexcept {
+        return request_;
+    }
+
+    ResponseType& response() noexcept {
+        return response_;
+    }
+
+   private:
+    RequestType request_;
+    ResponseType response_;
+};
+
+// Request and response messages allocated on the thread's CallArena, for unary calls.
+template <typename RequestType, typename ResponseType>
+class ArenaMessages {
+   public:
+    ArenaMessages()
+        : request_(RequestType::default_instance().New(arena_.get())),
+          response_(ResponseType::default_instance().New(arena_.get())) {}
+
+    RequestType& request() noexcept {
+        return *request_;
+    }
+
+    ResponseType& response() noexcept {
+        return *response_;
+    }
+
+   private:
+    CallArena arena_;
+    RequestType* request_;
+    ResponseType* response_;
+};
+
 }  // namespace client_helper_details
 
 // the authority on a grpc::ClientContext is sometimes set to an invalid uri on mac, causing
@@ -70,12 +175,41 @@ template <typename StubType, typename RequestType, typename ResponseType>
 using StreamingMethodType = std::unique_ptr<GrpcClientReaderInterface<ResponseType>> (StubType::*)(
     GrpcClientContext*, const RequestType&);
 
+#ifndef VIAMCPPSDK_GRPCXX_NO_CALLBACK_API
+
+// Method type for the gRPC callback API version of a call that returns a response message type.
+template <typename StubType, typename RequestType, typename ResponseType>
+using AsyncMethodType = void (StubType::async_interface::*)(GrpcClientContext*,
+                                                            const RequestType*,
+                                                            ResponseType*,
+                                                            std::function<void(::grpc::Status)>);
+
+// Names the callback API version of `Method` on `StubType`, for passing to
+// ClientHelper::invoke_async. With gRPC versions which lack the callback API this is null, and the
+// call is made through the synchronous stub instead.
+#define VIAMCPPSDK_ASYNC_METHOD(StubType, Method) (&StubType::async_interface::Method)
+
+#else
+
+template <typename StubType, typename RequestType, typename ResponseType>
+using AsyncMethodType = std::nullptr_t;
+
+#define VIAMCPPSDK_ASYNC_METHOD(StubType, Method) nullptr
+
+#endif
+
 template <typename ClientType,
           typename StubType,
           typename RequestType,
           typename ResponseType,
           typename MethodType>
 class ClientHelper {
+    // Unary calls allocate their messages on a per-thread arena rather than the heap.
+    using Messages = std::conditional_t<
+        std::is_same<MethodType, SyncMethodType<StubType, RequestType, ResponseType>>::value,
+        client_helper_details::ArenaMessages<RequestType, ResponseType>,
+        client_helper_details::HeapMessages<RequestType, ResponseType>>;
+
     static void default_rsc_(RequestType&) {}
     static void default_rhc_(const ResponseType&) {}
     static void default_ehc_(const ::grpc::Status* status) {
@@ -86,13 +220,17 @@ class ClientHelper {
     explicit ClientHelper(ClientType* client, StubType* stub, MethodType pfn)
         : client_(client), stub_(stub), pfn_(pfn) {}
 
+    // A helper which shares ownership of the client's stub, as `invoke_async` requires.
+    explicit ClientHelper(ClientType* client, std::shared_ptr<StubType> stub, MethodType pfn)
+        : client_(client), stub_(stub.get()), stub_owner_(std::move(stub)), pfn_(pfn) {}
+
     ClientHelper& with(const ProtoStruct& extra) {
         return with(extra, default_rsc_);
     }
 
     template <typename RequestSetupCallable>
     ClientHelper& with(RequestSetupCallable&& rsc) {
-        std::forward<RequestSetupCallable>(rsc)(request_);
+        std::forward<RequestSetupCallable>(rsc)(messages_.request());
         return *this;
     }
 
@@ -102,7 +240,8 @@ class ClientHelper {
             debug_key_ = std::move(*val);
         }
 
-        proto_convert_details::to_proto_impl<ProtoStruct>{}(extra, request_.mutable_extra());
+        proto_convert_details::to_proto_impl<ProtoStruct>{}(extra,
+                                                             messages_.request().mutable_extra());
         return with(std::forward<RequestSetupCallable>(rsc));
     }
 
@@ -113,37 +252,117 @@ class ClientHelper {
 
     template <typename ResponseHandlerCallable, typename ErrorHandlerCallable>
     auto invoke(ResponseHandlerCallable&& rhc, ErrorHandlerCallable&& ehc) {
-        client_helper_details::set_name(&request_, client_);
+        client_helper_details::set_name(&messages_.request(), client_);
         ClientContext ctx(client_->channel());
 
         if (debug_key_ != "") {
             ctx.set_debug_key(debug_key_);
         }
-        const auto result = (stub_->*pfn_)(ctx, request_, &response_);
+        const auto result = (stub_->*pfn_)(ctx, messages_.request(), &messages_.response());
         if (result.ok()) {
-            return std::forward<ResponseHandlerCallable>(rhc)(
-                const_cast<const ResponseType&>(response_));
+            return call_rhc_(std::forward<ResponseHandlerCallable>(rhc), messages_.response(), 0);
         }
 
         std::forward<ErrorHandlerCallable>(ehc)(&result);
         client_helper_details::errorHandlerReturnedUnexpectedly(&result);
     }
 
+    // A version of invoke which returns as soon as the call has started. The returned future becomes
+    // ready with the result of `rhc`, or with a GRPCException if the call fails, once the call
+    // completes. Completions of all in-flight calls are delivered on the threads of gRPC's callback
+    // API, so `rhc` should only convert the response. `async_pfn` is the callback API version of the
+    // method this helper was made with, as named by VIAMCPPSDK_ASYNC_METHOD. The helper must be
+    // made from the client's shared stub, which a call run on the blocking fallback keeps alive in
+    // case the client is destroyed before the call completes.
+    template <typename ResponseHandlerCallable = decltype(default_rhc_)>
+    auto invoke_async(AsyncMethodType<StubType, RequestType, ResponseType> async_pfn,
+                      ResponseHandlerCallable&& rhc = default_rhc_) {
+        using handler_type = std::decay_t<ResponseHandlerCallable>;
+        using result_type = std::decay_t<decltype(
+            call_rhc_(std::declval<handler_type&>(), std::declval<ResponseType&>(), 0))>;
+        // grpc::Status is only forward declared here; naming it through a dependent type defers
+        // the need for its definition to the client which instantiates this.
+        using status_type = std::conditional_t<sizeof(ResponseType) != 0, ::grpc::Status, void>;
+
+        // The call outlives this helper, so it takes its own copy of the request rather than using
+        // the one on this thread's arena.
+        struct async_call {
+            async_call(const ViamChannel& channel, handler_type rhc)
+                : ctx(channel), rhc(std::move(rhc)) {}
+
+            ClientContext ctx;
+            RequestType request;
+            ResponseType response;
+            status_type status;
+            handler_type rhc;
+            std::packaged_task<result_type()> complete;
+            std::function<void()> on_complete;
+        };
+
+        if (!stub_owner_) {
+            throw Exception("invoke_async requires a ClientHelper which shares its stub");
+        }
+
+        auto call = std::make_shared<async_call>(client_->channel(),
+                                                 std::forward<ResponseHandlerCallable>(rhc));
+        call->request = std::move(messages_.request());
+        client_helper_details::set_name(&call->request, client_);
+        if (debug_key_ != "") {
+            call->ctx.set_debug_key(debug_key_);
+        }
+
+        call->complete = std::packaged_task<result_type()>([raw = call.get()] {
+            if (!raw->status.ok()) {
+                throw GRPCException(&raw->status);
+            }
+            return static_cast<result_type>(call_rhc_(raw->rhc, raw->response, 0));
+        });
+        auto result = call->complete.get_future();
+        if (const auto* scope = client_helper_details::CallScope::current()) {
+            call->on_complete = scope->on_async_complete();
+        }
+
+#ifndef VIAMCPPSDK_GRPCXX_NO_CALLBACK_API
+        if (auto* const async_stub = stub_->async()) {
+            (async_stub->*async_pfn)(
+                call->ctx, &call->request, &call->response, [call](status_type status) {
+                    call->status = std::move(status);
+                    call->complete();
+                    if (call->on_complete) {
+                        call->on_complete();
+                    }
+                });
+            return result;
+        }
+#else
+        (void)async_pfn;
+#endif
+
+        client_helper_details::post_blocking_call([call, stub = stub_owner_, pfn = pfn_] {
+            call->status = ((*stub).*pfn)(call->ctx, call->request, &call->response);
+            call->complete();
+            if (call->on_complete) {
+                call->on_complete();
+            }
+        });
+        return result;
+    }
+
     // A version of invoke for gRPC calls returning `(stream ResponseType)`.
     // ResponseHandlerCallable will be called for every response in the reader, and should return
     // false to indicate it is no longer interested in the stream.
     template <typename ResponseHandlerCallable,
               typename ErrorHandlerCallable = decltype(default_ehc_)>
     auto invoke_stream(ResponseHandlerCallable rhc, ErrorHandlerCallable&& ehc = default_ehc_) {
-        *request_.mutable_name() = client_->name();
+        *messages_.request().mutable_name() = client_->name();
         ClientContext ctx(client_->channel());
 
-        auto reader = (stub_->*pfn_)(ctx, request_);
+        auto reader = (stub_->*pfn_)(ctx, messages_.request());
 
         bool cancelled_by_handler = false;
 
-        while (reader->Read(&response_)) {
-            if (!rhc(response_)) {
+        while (reader->Read(&messages_.response())) {
+            if (!rhc(messages_.response())) {
                 cancelled_by_handler = true;
                 ctx.try_cancel();
                 break;
@@ -162,12 +381,27 @@ class ClientHelper {
     }
 
    private:
+    // Response handlers which accept an rvalue may move fields (e.g. large `bytes` payloads) out of
+    // the response, since it is not used again once the handler returns. All other handlers see the
+    // response as const.
+    template <typename ResponseHandlerCallable>
+    static auto call_rhc_(ResponseHandlerCallable&& rhc, ResponseType& response, int)
+        -> decltype(std::forward<ResponseHandlerCallable>(rhc)(std::declval<ResponseType&&>())) {
+        return std::forward<ResponseHandlerCallable>(rhc)(std::move(response));
+    }
+
+    template <typename ResponseHandlerCallable>
+    static decltype(auto) call_rhc_(ResponseHandlerCallable&& rhc, ResponseType& response, long) {
+        return std::forward<ResponseHandlerCallable>(rhc)(
+            const_cast<const ResponseType&>(response));
+    }
+
     ClientType* client_;
     StubType* stub_;
+    std::shared_ptr<StubType> stub_owner_;
     std::string debug_key_;
     MethodType pfn_;
-    RequestType request_;
-    ResponseType response_;
+    Messages messages_;
 };
 
 template <typename ClientType, typename StubType, typename RequestType, typename ResponseType>
@@ -181,6 +415,17 @@ auto make_client_helper(ClientType* client,
                         SyncMethodType<StubType, RequestType, ResponseType>>(client, &stub, method);
 }
 
+template <typename ClientType, typename StubType, typename RequestType, typename ResponseType>
+auto make_client_helper(ClientType* client,
+                        const std::shared_ptr<StubType>& stub,
+                        SyncMethodType<StubType, RequestType, ResponseType> method) {
+    return ClientHelper<ClientType,
+                        StubType,
+                        RequestType,
+                        ResponseType,
+                        SyncMethodType<StubType, RequestType, ResponseType>>(client, stub, method);
+}
+
 template <typename ClientType, typename StubType, typename RequestType, typename ResponseType>
 auto make_client_helper(ClientType* client,
                         StubType& stub,
@@ -0,0 +1,207 @@
+#include <viam/sdk/common/flat_proto_struct.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+#include <google/protobuf/struct.pb.h>
+
+namespace viam {
+namespace sdk {
+
+namespace {
+
+bool key_less(const std::string& entry_key, const char* key, std::size_t size) {
+    return entry_key.compare(0, std::string::npos, key, size) < 0;
+}
+
+bool key_equal(const std::string& entry_key, const char* key, std::size_t size) {
+    return entry_key.compare(0, std::string::npos, key, size) == 0;
+}
+
+}  // namespace
+
+constexpr std::size_t FlatProtoStruct::inline_capacity;
+
+FlatProtoStruct::FlatProtoStruct(std::initializer_list<value_type> entries)
+    : entries_(entries.begin(), entries.end()) {
+    sort_unique_();
+}
+
+FlatProtoStruct::FlatProtoStruct(const ProtoStruct& map) : entries_(map.begin(), map.end()) {
+    sort_unique_();
+}
+
+FlatProtoStruct::FlatProtoStruct(ProtoStruct&& map) {
+    entries_.reserve(map.size());
+    for (auto& kv : map) {
+        entries_.emplace_back(kv.first, std::move(kv.second));
+    }
+    map.clear();
+    sort_unique_();
+}
+
+ProtoStruct FlatProtoStruct::to_proto_struct() const& {
+    return ProtoStruct(entries_.begin(), entries_.end());
+}
+
+ProtoStruct FlatProtoStruct::to_proto_struct() && {
+    ProtoStruct result;
+    result.reserve(entries_.size());
+    for (auto& entry : entries_) {
+        result.emplace(std::move(entry.first), std::move(entry.second));
+    }
+    entries_.clear();
+    return result;
+}
+
+void FlatProtoStruct::assign(const google::protobuf::Struct& proto) {
+    entries_.clear();
+    entries_.reserve(proto.fields().size());
+    for (const auto& field : proto.fields()) {
+        entries_.emplace_back(field.first, from_proto(field.second));
+    }
+    // Keys in a protobuf map are already unique, so only the sort is needed.
+    std::sort(entries_.begin(), entries_.end(), [](const entry_type& lhs, const entry_type& rhs) {
+        return lhs.first < rhs.first;
+    });
+}
+
+FlatProtoStruct::iterator FlatProtoStruct::find(const std::string& key) {
+    const auto it = lower_bound_(key.data(), key.size());
+    return (it != entries_.end() && key_equal(it->first, key.data(), key.size())) ? iterator(it)
+                                                                                   : end();
+}
+
+FlatProtoStruct::iterator FlatProtoStruct::find(const char* key) {
+    const std::size_t size = std::strlen(key);
+    const auto it = lower_bound_(key, size);
+    return (it != entries_.end() && key_equal(it->first, key, size)) ? iterator(it) : end();
+}
+
+FlatProtoStruct::const_iterator FlatProtoStruct::find(const std::string& key) const {
+    const auto it = lower_bound_(key.data(), key.size());
+    return (it != entries_.end() && key_equal(it->first, key.data(), key.size()))
+               ? const_iterator(it)
+               : end();
+}
+
+FlatProtoStruct::const_iterator FlatProtoStruct::find(const char* key) const {
+    const std::size_t size = std::strlen(key);
+    const auto it = lower_bound_(key, size);
+    return (it != entries_.end() && key_equal(it->first, key, size)) ? const_iterator(it) : end();
+}
+
+FlatProtoStruct::size_type FlatProtoStruct::count(const std::string& key) const {
+    return find(key) == end() ? 0 : 1;
+}
+
+FlatProtoStruct::size_type FlatProtoStruct::count(const char* key) const {
+    return find(key) == end() ? 0 : 1;
+}
+
+ProtoValue& FlatProtoStruct::at(const std::string& key) {
+    const auto it = find(key);
+    if (it == end()) {
+        throw std::out_of_range("FlatProtoStruct has no key " + key);
+    }
+    return it->second;
+}
+
+const ProtoValue& FlatProtoStruct::at(const std::string& key) const {
+    const auto it = find(key);
+    if (it == end()) {
+        throw std::out_of_range("FlatProtoStruct has no key " + key);
+    }
+    return it->second;
+}
+
+ProtoValue& FlatProtoStruct::operator[](const std::string& key) {
+    auto it = lower_bound_(key.data(), key.size());
+    if (it == entries_.end() || !key_equal(it->first, key.data(), key.size())) {
+        it = entries_.emplace(it, key, ProtoValue());
+    }
+    return it->second;
+}
+
+std::pair<FlatProtoStruct::iterator, bool> FlatProtoStruct::emplace(std::string key,
+                                                                    ProtoValue value) {
+    const auto it = lower_bound_(key.data(), key.size());
+    if (it != entries_.end() && key_equal(it->first, key.data(), key.size())) {
+        return {iterator(it), false};
+    }
+    return {iterator(entries_.emplace(it, std::move(key), std::move(value))), true};
+}
+
+std::pair<FlatProtoStruct::iterator, bool> FlatProtoStruct::insert_or_assign(std::string key,
+                                                                             ProtoValue value) {
+    const auto it = lower_bound_(key.data(), key.size());
+    if (it != entries_.end() && key_equal(it->first, key.data(), key.size())) {
+        it->second = std::move(value);
+        return {iterator(it), false};
+    }
+    return {iterator(entries_.emplace(it, std::move(key), std::move(value))), true};
+}
+
+FlatProtoStruct::size_type FlatProtoStruct::erase(const std::string& key) {
+    const auto it = find(key);
+    if (it == end()) {
+        return 0;
+    }
+    entries_.erase(it.base());
+    return 1;
+}
+
+FlatProtoStruct::iterator FlatProtoStruct::erase(const_iterator pos) {
+    return iterator(entries_.erase(pos.base()));
+}
+
+bool operator==(const FlatProtoStruct& lhs, const FlatProtoStruct& rhs) {
+    // Both sides are sorted by key, so equal maps have equal entries at each position.
+    return lhs.entries_.size() == rhs.entries_.size() &&
+           std::equal(lhs.entries_.begin(), lhs.entries_.end(), rhs.entries_.begin());
+}
+
+FlatProtoStruct::container_type::iterator FlatProtoStruct::lower_bound_(const char* key,
+                                                                        std::size_t size) {
+    return std::lower_bound(
+        entries_.begin(), entries_.end(), key, [size](const entry_type& entry, const char* k) {
+            return key_less(entry.first, k, size);
+        });
+}
+
+FlatProtoStruct::container_type::const_iterator FlatProtoStruct::lower_bound_(
+    const char* key, std::size_t size) const {
+    return std::lower_bound(
+        entries_.begin(), entries_.end(), key, [size](const entry_type& entry, const char* k) {
+            return key_less(entry.first, k, size);
+        });
+}
+
+void FlatProtoStruct::sort_unique_() {
+    const auto by_key = [](const entry_type& lhs, const entry_type& rhs) {
+        return lhs.first < rhs.first;
+    };
+    std::stable_sort(entries_.begin(), entries_.end(), by_key);
+    entries_.erase(std::unique(entries_.begin(),
+                               entries_.end(),
+                               [](const entry_type& lhs, const entry_type& rhs) {
+                                   return lhs.first == rhs.first;
+                               }),
+                   entries_.end());
+}
+
+namespace proto_convert_details {
+
+void to_proto_impl<FlatProtoStruct>::operator()(const FlatProtoStruct& self,
+                                                google::protobuf::Struct* s) const {
+    auto& fields = *s->mutable_fields();
+    for (const auto& entry : self) {
+        to_proto_impl<ProtoValue>{}(entry.second, &fields[entry.first]);
+    }
+}
+
+}  // namespace proto_convert_details
+
+}  // namespace sdk
+}  // namespace viam
@@ -0,0 +1,238 @@
+/// @file common/flat_proto_struct.hpp
+///
+/// @brief Defines `FlatProtoStruct`, a contiguous alternative to `ProtoStruct`.
+#pragma once
+
+#include <cstddef>
+#include <initializer_list>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include <boost/container/small_vector.hpp>
+#include <boost/iterator/iterator_adaptor.hpp>
+
+#include <viam/sdk/common/proto_value.hpp>
+
+namespace viam {
+namespace sdk {
+
+/// @class FlatProtoStruct flat_proto_struct.hpp "common/flat_proto_struct.hpp"
+/// @brief A string-keyed map of ProtoValue stored as a sorted, contiguous array of entries.
+/// @remark ProtoStruct is a node-based hash map, so building one costs an allocation per field plus
+/// the bucket array. A FlatProtoStruct keeps its first `inline_capacity` entries inside the object
+/// itself and the rest in a single buffer, and `clear` keeps that buffer, so a struct which is
+/// reused across requests stops allocating for its entries once it has warmed up. Lookup is a
+/// binary search, which for the handful of fields in typical readings or `extra` parameters is
+/// faster than hashing the key.
+/// @remark Values are ordinary ProtoValues, so nested structs are still ProtoStructs, and the
+/// functions in proto_value_visit.hpp apply unchanged to the mapped values.
+class FlatProtoStruct {
+   public:
+    /// @brief The number of entries stored without any heap allocation.
+    static constexpr std::size_t inline_capacity = 4;
+
+    using key_type = std::string;
+    using mapped_type = ProtoValue;
+    using value_type = std::pair<const std::string, ProtoValue>;
+    using size_type = std::size_t;
+
+   private:
+    // Entries are stored with mutable keys so that they can be sorted and moved, but are only
+    // handed out through iterators which keep the key const, as with std::map, since changing a
+    // key would break the order that lookup relies on.
+    using entry_type = std::pair<std::string, ProtoValue>;
+    using container_type = boost::container::small_vector<entry_type, inline_capacity>;
+
+   public:
+    /// @brief What an iterator dereferences to: the key of an entry, which can't be modified, and
+    /// its value.
+    template <typename Value>
+    struct basic_reference {
+        const std::string& first;
+        Value& second;
+
+        operator value_type() const {
+            return {first, second};
+        }
+    };
+
+    /// @brief An iterator over the entries, which dereferences to a `basic_reference` rather than
+    /// to a `value_type&`.
+    template <typename Base, typename Value>
+    class basic_iterator : public boost::iterator_adaptor<basic_iterator<Base, Value>,
+                                                          Base,
+                                                          value_type,
+                                                          boost::use_default,
+                                                          basic_reference<Value>> {
+       public:
+        basic_iterator() = default;
+
+        /// @brief Converts an iterator to a const_iterator.
+        template <typename OtherBase,
+                  typename OtherValue,
+                  typename = std::enable_if_t<std::is_convertible<OtherBase, Base>::value>>
+        basic_iterator(const basic_iterator<OtherBase, OtherValue>& other)
+            : basic_iterator::iterator_adaptor_(other.base()) {}
+
+       private:
+        friend class FlatProtoStruct;
+        friend class boost::iterator_core_access;
+
+        explicit basic_iterator(Base base) : basic_iterator::iterator_adaptor_(base) {}
+
+        basic_reference<Value> dereference() const {
+            return {this->base()->first, this->base()->second};
+        }
+    };
+
+    using iterator = basic_iterator<container_type::iterator, ProtoValue>;
+    using const_iterator = basic_iterator<container_type::const_iterator, const ProtoValue>;
+
+    FlatProtoStruct() = default;
+
+    /// @brief Construct from a list of entries. If a key appears more than once, the first entry
+    /// with that key is kept, as with ProtoStruct.
+    FlatProtoStruct(std::initializer_list<value_type> entries);
+
+    /// @brief Construct with the same contents as a ProtoStruct.
+    explicit FlatProtoStruct(const ProtoStruct& map);
+
+    /// @brief Construct with the contents of a ProtoStruct, moving its keys and values.
+    explicit FlatProtoStruct(ProtoStruct&& map);
+
+    /// @brief Copy the contents of this into a ProtoStruct.
+    ProtoStruct to_proto_struct() const&;
+
+    /// @brief Move the contents of this into a ProtoStruct.
+    ProtoStruct to_proto_struct() &&;
+
+    /// @brief Replace the contents of this with those of a google::protobuf::Struct, reusing the
+    /// storage already held by this.
+    void assign(const google::protobuf::Struct& proto);
+
+    /// @name Capacity
+    /// @{
+
+    bool empty() const noexcept {
+        return entries_.empty();
+    }
+
+    size_type size() const noexcept {
+        return entries_.size();
+    }
+
+    size_type capacity() const noexcept {
+        return entries_.capacity();
+    }
+
+    void reserve(size_type n) {
+        entries_.reserve(n);
+    }
+
+    /// @brief Remove all entries. The storage is kept for reuse.
+    void clear() noexcept {
+        entries_.clear();
+    }
+
+    /// @}
+
+    /// @name Iteration
+    /// @brief Entries are visited in ascending order of key.
+    /// @{
+
+    iterator begin() noexcept {
+        return iterator(entries_.begin());
+    }
+
+    iterator end() noexcept {
+        return iterator(entries_.end());
+    }
+
+    const_iterator begin() const noexcept {
+        return const_iterator(entries_.begin());
+    }
+
+    const_iterator end() const noexcept {
+        return const_iterator(entries_.end());
+    }
+
+    const_iterator cbegin() const noexcept {
+        return const_iterator(entries_.cbegin());
+    }
+
+    const_iterator cend() const noexcept {
+        return const_iterator(entries_.cend());
+    }
+
+    /// @}
+
+    /// @name Lookup
+    /// @brief The `const char*` overloads look a key up without constructing a std::string.
+    /// @{
+
+    iterator find(const std::string& key);
+    iterator find(const char* key);
+    const_iterator find(const std::string& key) const;
+    const_iterator find(const char* key) const;
+
+    size_type count(const std::string& key) const;
+    size_type count(const char* key) const;
+
+    /// @throws std::out_of_range if there is no entry for `key`.
+    ProtoValue& at(const std::string& key);
+
+    /// @throws std::out_of_range if there is no entry for `key`.
+    const ProtoValue& at(const std::string& key) const;
+
+    /// @brief Return the value for `key`, inserting a null value if there is none.
+    ProtoValue& operator[](const std::string& key);
+
+    /// @}
+
+    /// @name Modifiers
+    /// @{
+
+    /// @brief Insert `value` under `key` if there is no entry for `key` already.
+    /// @return An iterator to the entry for `key`, and whether the insertion took place.
+    std::pair<iterator, bool> emplace(std::string key, ProtoValue value);
+
+    /// @brief Insert `value` under `key`, replacing any existing value.
+    /// @return An iterator to the entry for `key`, and whether a new entry was added.
+    std::pair<iterator, bool> insert_or_assign(std::string key, ProtoValue value);
+
+    /// @brief Remove the entry for `key`, if any.
+    /// @return The number of entries removed.
+    size_type erase(const std::string& key);
+
+    iterator erase(const_iterator pos);
+
+    /// @}
+
+    friend bool operator==(const FlatProtoStruct& lhs, const FlatProtoStruct& rhs);
+
+   private:
+    container_type::iterator lower_bound_(const char* key, std::size_t size);
+    container_type::const_iterator lower_bound_(const char* key, std::size_t size) const;
+
+    // Sort entries_ by key and drop entries with duplicate keys, keeping the first of each.
+    void sort_unique_();
+
+    container_type entries_;
+};
+
+inline bool operator!=(const FlatProtoStruct& lhs, const FlatProtoStruct& rhs) {
+    return !(lhs == rhs);
+}
+
+namespace proto_convert_details {
+
+template <>
+struct to_proto_impl<FlatProtoStruct> {
+    void operator()(const FlatProtoStruct&, google::protobuf::Struct*) const;
+};
+
+}  // namespace proto_convert_details
+
+}  // namespace sdk
+}  // namespace viam
@@ -16,11 +16,11 @@ bool operator==(const mesh& lhs, const mesh& rhs) {
 namespace proto_convert_details {
 void to_proto_impl<mesh>::operator()(const mesh& self, common::v1::Mesh* proto) const {
     proto->set_content_type(self.content_type);
-    proto->set_mesh(bytes_to_string(self.data));
+    proto->set_mesh(self.data.to_string());
 }
 
 mesh from_proto_impl<common::v1::Mesh>::operator()(const common::v1::Mesh* proto) const {
-    return mesh{proto->content_type(), string_to_bytes(proto->mesh())};
+    return mesh{proto->content_type(), SharedBytes(proto->mesh())};
 }
 
 }  // namespace proto_convert_details
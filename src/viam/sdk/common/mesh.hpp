@@ -1,6 +1,7 @@
 #pragma once
 
 #include <viam/sdk/common/proto_convert.hpp>
+#include <viam/sdk/common/shared_bytes.hpp>
 
 #include <string>
 #include <vector>
@@ -20,7 +21,7 @@ namespace sdk {
 
 struct mesh {
     std::string content_type;
-    std::vector<unsigned char> data;
+    SharedBytes data;
 };
 
 bool operator==(const mesh& lhs, const mesh& rhs);
@@ -0,0 +1,51 @@
+#include <viam/sdk/common/private/byteswap.hpp>
+
+#include <cstdint>
+#include <cstring>
+
+#include <boost/endian/conversion.hpp>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define VIAMCPPSDK_BYTESWAP_SSE2
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define VIAMCPPSDK_BYTESWAP_NEON
+#endif
+
+namespace viam {
+namespace sdk {
+namespace impl {
+
+void copy_big_endian_16(const void* src, void* dst, std::size_t count) noexcept {
+    const auto* in = static_cast<const unsigned char*>(src);
+    auto* out = static_cast<unsigned char*>(dst);
+
+    if (boost::endian::order::native == boost::endian::order::big) {
+        std::memcpy(out, in, count * sizeof(std::uint16_t));
+        return;
+    }
+
+    std::size_t i = 0;
+
+#if defined(VIAMCPPSDK_BYTESWAP_SSE2)
+    for (; i + 8 <= count; i += 8) {
+        const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i * 2));
+        const __m128i swapped = _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i * 2), swapped);
+    }
+#elif defined(VIAMCPPSDK_BYTESWAP_NEON)
+    for (; i + 8 <= count; i += 8) {
+        vst1q_u8(out + i * 2, vrev16q_u8(vld1q_u8(in + i * 2)));
+    }
+#endif
+
+    for (; i < count; ++i) {
+        out[i * 2] = in[i * 2 + 1];
+        out[i * 2 + 1] = in[i * 2];
+    }
+}
+
+}  // namespace impl
+}  // namespace sdk
+}  // namespace viam
@@ -0,0 +1,16 @@
+#pragma once
+
+#include <cstddef>
+
+namespace viam {
+namespace sdk {
+namespace impl {
+
+// Copies `count` 16-bit values from `src` to `dst`, converting between big-endian and native
+// byte order. The conversion is its own inverse, so this both encodes and decodes. Neither pointer
+// needs to be aligned, but the ranges must not overlap.
+void copy_big_endian_16(const void* src, void* dst, std::size_t count) noexcept;
+
+}  // namespace impl
+}  // namespace sdk
+}  // namespace viam
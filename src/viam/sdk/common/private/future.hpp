@@ -0,0 +1,25 @@
+#pragma once
+
+#include <future>
+#include <type_traits>
+#include <utility>
+
+namespace viam {
+namespace sdk {
+namespace impl {
+
+// Calls `fn` now and returns a future which is already ready with its result, or with the exception
+// it threw. This is the default implementation of the `_async` resource methods, which only the
+// resource clients make asynchronously.
+template <typename Callable>
+auto make_ready_future(Callable&& fn) {
+    std::packaged_task<std::result_of_t<std::decay_t<Callable>()>()> task(
+        std::forward<Callable>(fn));
+    auto result = task.get_future();
+    task();
+    return result;
+}
+
+}  // namespace impl
+}  // namespace sdk
+}  // namespace viam
@@ -0,0 +1,27 @@
+#pragma once
+
+#include <string>
+
+#include <google/protobuf/map.h>
+#include <google/protobuf/struct.pb.h>
+
+#include <viam/sdk/common/proto_value.hpp>
+
+namespace viam {
+namespace sdk {
+namespace impl {
+
+// The type of google::protobuf::Struct::fields(), which many responses use directly for a
+// string-keyed map of values, e.g. `GetReadingsResponse::readings`.
+using proto_field_map = ::google::protobuf::Map<std::string, ::google::protobuf::Value>;
+
+// Writes the entries of `s` straight into `fields`, without building an intermediate
+// google::protobuf::Struct to copy them out of. Existing entries with other keys are kept.
+void to_proto_fields(const ProtoStruct& s, proto_field_map* fields);
+
+// Converts a map of fields which is no longer needed, moving its strings and nested values.
+ProtoStruct from_proto_fields(proto_field_map&& fields);
+
+}  // namespace impl
+}  // namespace sdk
+}  // namespace viam
@@ -45,5 +45,22 @@ namespace sdk {
 
 // NOLINTEND(bugprone-exception-escape)
 
+namespace impl {
+
+RequestExtra::RequestExtra(ProtoStructView view) {
+    static const ProtoStruct empty;
+    static const ProtoStruct capture{{"fromDataManagement", true}};
+
+    if (view.empty()) {
+        shared_ = &empty;
+    } else if (view.size() == 1 && view.get_bool("fromDataManagement") == true) {
+        shared_ = &capture;
+    } else {
+        owned_ = view.to_proto_struct();
+    }
+}
+
+}  // namespace impl
+
 }  // namespace sdk
 }  // namespace viam
@@ -6,6 +6,7 @@
 #include <grpcpp/support/status.h>
 
 #include <viam/sdk/common/grpc_fwd.hpp>
+#include <viam/sdk/common/proto_struct_view.hpp>
 
 #include <viam/sdk/resource/resource_server_base.hpp>
 #include <viam/sdk/rpc/private/grpc_context_observer.hpp>
@@ -39,6 +40,26 @@ class ServiceHelperBase {
     const char* method_;
 };
 
+namespace impl {
+
+// The `extra` of a request, as the `const ProtoStruct&` which resource methods take. An empty
+// `extra`, which clients send with most calls, and the `{"fromDataManagement": true}` which the
+// data manager sends with every capture, refer to shared structs instead of being converted.
+class RequestExtra {
+   public:
+    explicit RequestExtra(ProtoStructView view);
+
+    operator const ProtoStruct&() const noexcept {
+        return shared_ ? *shared_ : owned_;
+    }
+
+   private:
+    ProtoStruct owned_;
+    const ProtoStruct* shared_ = nullptr;
+};
+
+}  // namespace impl
+
 template <typename ServiceType, typename RequestType>
 class ServiceHelper : public ServiceHelperBase {
    public:
@@ -81,8 +102,16 @@ class ServiceHelper : public ServiceHelperBase {
         return failUnknownException();
     }
 
-    auto getExtra() const {
-        return request_->has_extra() ? from_proto(request_->extra()) : ProtoStruct{};
+    // The request's `extra`, to pass to a resource method. It is converted to a ProtoStruct only
+    // if it is neither empty nor the `extra` of a data capture; see `impl::RequestExtra`.
+    impl::RequestExtra getExtra() const {
+        return impl::RequestExtra(extra_view());
+    }
+
+    // A view of the request's `extra` for handlers which only inspect a few keys, without
+    // converting it.
+    ProtoStructView extra_view() const noexcept {
+        return ProtoStructView(request_->has_extra() ? &request_->extra() : nullptr);
     }
 
    private:
@@ -0,0 +1,130 @@
+#include <viam/sdk/common/proto_struct_view.hpp>
+
+#include <google/protobuf/struct.pb.h>
+
+namespace viam {
+namespace sdk {
+
+using google::protobuf::Value;
+
+namespace {
+
+// Structs with at most this many fields are searched by comparing every key.
+constexpr int k_max_scanned_fields = 16;
+
+}  // namespace
+
+bool ProtoStructView::empty() const noexcept {
+    return !proto_ || proto_->fields().empty();
+}
+
+std::size_t ProtoStructView::size() const noexcept {
+    return proto_ ? proto_->fields().size() : 0;
+}
+
+bool ProtoStructView::contains(boost::string_view key) const {
+    return find_(key) != nullptr;
+}
+
+boost::optional<ProtoValue::Kind> ProtoStructView::kind(boost::string_view key) const {
+    const Value* value = find_(key);
+    if (!value) {
+        return boost::none;
+    }
+
+    switch (value->kind_case()) {
+        case Value::KindCase::kBoolValue:
+            return ProtoValue::Kind::k_bool;
+        case Value::KindCase::kNumberValue:
+            return ProtoValue::Kind::k_double;
+        case Value::KindCase::kStringValue:
+            return ProtoValue::Kind::k_string;
+        case Value::KindCase::kListValue:
+            return ProtoValue::Kind::k_list;
+        case Value::KindCase::kStructValue:
+            return ProtoValue::Kind::k_struct;
+        case Value::KindCase::KIND_NOT_SET:
+        case Value::KindCase::kNullValue:
+        default:
+            return ProtoValue::Kind::k_null;
+    }
+}
+
+boost::optional<bool> ProtoStructView::get_bool(boost::string_view key) const {
+    const Value* value = find_(key);
+    if (!value || value->kind_case() != Value::KindCase::kBoolValue) {
+        return boost::none;
+    }
+    return value->bool_value();
+}
+
+boost::optional<double> ProtoStructView::get_double(boost::string_view key) const {
+    const Value* value = find_(key);
+    if (!value || value->kind_case() != Value::KindCase::kNumberValue) {
+        return boost::none;
+    }
+    return value->number_value();
+}
+
+const std::string* ProtoStructView::get_string(boost::string_view key) const {
+    const Value* value = find_(key);
+    if (!value || value->kind_case() != Value::KindCase::kStringValue) {
+        return nullptr;
+    }
+    return &value->string_value();
+}
+
+boost::optional<ProtoStructView> ProtoStructView::get_struct(boost::string_view key) const {
+    const Value* value = find_(key);
+    if (!value || value->kind_case() != Value::KindCase::kStructValue) {
+        return boost::none;
+    }
+    return ProtoStructView(value->struct_value());
+}
+
+boost::optional<ProtoValue> ProtoStructView::get(boost::string_view key) const {
+    const Value* value = find_(key);
+    if (!value) {
+        return boost::none;
+    }
+    return from_proto(*value);
+}
+
+void ProtoStructView::for_each(
+    const std::function<void(const std::string&, const Value&)>& fn) const {
+    if (!proto_) {
+        return;
+    }
+    for (const auto& field : proto_->fields()) {
+        fn(field.first, field.second);
+    }
+}
+
+ProtoStruct ProtoStructView::to_proto_struct() const {
+    return empty() ? ProtoStruct{} : from_proto(*proto_);
+}
+
+const Value* ProtoStructView::find_(boost::string_view key) const {
+    if (!proto_) {
+        return nullptr;
+    }
+
+    // A struct such as a request's `extra` usually holds a handful of fields, which are quicker
+    // to compare in place than to hash. Hashing needs the key as a std::string, so it is only
+    // worth doing for larger structs.
+    const auto& fields = proto_->fields();
+    if (fields.size() <= k_max_scanned_fields) {
+        for (const auto& field : fields) {
+            if (boost::string_view(field.first) == key) {
+                return &field.second;
+            }
+        }
+        return nullptr;
+    }
+
+    const auto it = fields.find(std::string(key.data(), key.size()));
+    return it == fields.end() ? nullptr : &it->second;
+}
+
+}  // namespace sdk
+}  // namespace viam
@@ -0,0 +1,87 @@
+/// @file common/proto_struct_view.hpp
+///
+/// @brief Defines `ProtoStructView`, a read-only view of a google::protobuf::Struct.
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <string>
+
+#include <boost/optional/optional.hpp>
+#include <boost/utility/string_view.hpp>
+
+#include <viam/sdk/common/proto_value.hpp>
+
+namespace viam {
+namespace sdk {
+
+/// @class ProtoStructView proto_struct_view.hpp "common/proto_struct_view.hpp"
+/// @brief A non-owning, read-only view of a google::protobuf::Struct, such as the `extra` of a
+/// request.
+/// @remark Converting a Struct to a ProtoStruct copies every key and value into newly allocated
+/// nodes. A view instead reads the Struct where it is, so looking up one or two keys, or checking
+/// whether there are any, costs no allocation. Keys are compared in place, so looking one up by a
+/// string literal does not build a std::string either, unless the Struct has many fields. Use
+/// `to_proto_struct` to materialize a ProtoStruct when one is needed, e.g. to pass to a resource
+/// method.
+/// @remark The viewed Struct must outlive the view.
+class ProtoStructView {
+   public:
+    /// @brief Construct a view of an empty struct.
+    ProtoStructView() noexcept = default;
+
+    /// @brief Construct a view of `proto`, which may be null to view an empty struct.
+    explicit ProtoStructView(const google::protobuf::Struct* proto) noexcept : proto_(proto) {}
+
+    /// @brief Construct a view of `proto`.
+    explicit ProtoStructView(const google::protobuf::Struct& proto) noexcept : proto_(&proto) {}
+
+    bool empty() const noexcept;
+
+    std::size_t size() const noexcept;
+
+    bool contains(boost::string_view key) const;
+
+    /// @brief The kind of the value stored under `key`, or none if there is no such key.
+    boost::optional<ProtoValue::Kind> kind(boost::string_view key) const;
+
+    /// @name Typed getters
+    /// @brief Each returns none, or null, if there is no value for `key` or the value stored there
+    /// is of a different kind.
+    /// @{
+
+    boost::optional<bool> get_bool(boost::string_view key) const;
+
+    boost::optional<double> get_double(boost::string_view key) const;
+
+    /// @brief Return a pointer to the string stored in the viewed Struct, without copying it.
+    const std::string* get_string(boost::string_view key) const;
+
+    /// @brief Return a view of a nested struct.
+    boost::optional<ProtoStructView> get_struct(boost::string_view key) const;
+
+    /// @}
+
+    /// @brief Convert just the value stored under `key` to a ProtoValue.
+    boost::optional<ProtoValue> get(boost::string_view key) const;
+
+    /// @brief Call `fn` with the key and value of each field, in unspecified order.
+    void for_each(
+        const std::function<void(const std::string&, const google::protobuf::Value&)>& fn) const;
+
+    /// @brief Copy the viewed Struct into a ProtoStruct.
+    ProtoStruct to_proto_struct() const;
+
+    /// @brief The viewed Struct, or null if this views an empty struct.
+    const google::protobuf::Struct* proto() const noexcept {
+        return proto_;
+    }
+
+   private:
+    const google::protobuf::Value* find_(boost::string_view key) const;
+
+    const google::protobuf::Struct* proto_ = nullptr;
+};
+
+}  // namespace sdk
+}  // namespace viam
@@ -1,7 +1,10 @@
 #include <viam/sdk/common/proto_value.hpp>
 
+#include <google/protobuf/arena.h>
 #include <google/protobuf/struct.pb.h>
 
+#include <viam/sdk/common/private/proto_value.hpp>
+
 namespace viam {
 namespace sdk {
 
@@ -222,16 +225,22 @@ void to_value(std::string s, Value* v) {
     v->set_string_value(std::move(s));
 }
 
-void to_value(const ProtoList& vec, Value* v) {
-    ::google::protobuf::ListValue l;
+// The list and struct overloads write into the messages owned by `v` rather than converting into
+// temporaries and copying those in, so nested values are built in place, on `v`'s arena if it has
+// one.
+void to_value(const ProtoList& vec, Value* v) {  // NOLINT(misc-no-recursion)
+    auto* values = v->mutable_list_value()->mutable_values();
+    values->Clear();
+    values->Reserve(static_cast<int>(vec.size()));
     for (const auto& val : vec) {
-        *l.add_values() = to_proto(val);
+        proto_convert_details::to_proto_impl<ProtoValue>{}(val, values->Add());
     }
-    *(v->mutable_list_value()) = std::move(l);
 }
 
-void to_value(const ProtoStruct& m, Value* v) {
-    *(v->mutable_struct_value()) = to_proto(m);
+void to_value(const ProtoStruct& m, Value* v) {  // NOLINT(misc-no-recursion)
+    auto* s = v->mutable_struct_value();
+    s->Clear();
+    proto_convert_details::to_proto_impl<ProtoStruct>{}(m, s);
 }
 
 }  // namespace proto_value_details
@@ -274,17 +283,16 @@ ProtoValue from_proto_impl<google::protobuf::Value>::operator()(  // NOLINT(misc
     }
 }
 
-void to_proto_impl<ProtoStruct>::operator()(const ProtoStruct& self,
-                                            google::protobuf::Struct* s) const {
-    for (const auto& kv : self) {
-        s->mutable_fields()->insert(
-            google::protobuf::MapPair<std::string, Value>(kv.first, to_proto(kv.second)));
-    }
+void to_proto_impl<ProtoStruct>::operator()(  // NOLINT(misc-no-recursion)
+    const ProtoStruct& self,
+    google::protobuf::Struct* s) const {
+    impl::to_proto_fields(self, s->mutable_fields());
 }
 
 ProtoStruct from_proto_impl<google::protobuf::Struct>::operator()(  // NOLINT(misc-no-recursion)
     const google::protobuf::Struct* s) const {
     ProtoStruct result;
+    result.reserve(s->fields().size());
 
     for (const auto& val : s->fields()) {
         result.emplace(val.first, from_proto(val.second));
@@ -295,5 +303,67 @@ ProtoStruct from_proto_impl<google::protobuf::Struct>::operator()(  // NOLINT(mi
 
 }  // namespace proto_convert_details
 
+ProtoValue from_proto(Value&& proto) {  // NOLINT(misc-no-recursion)
+    switch (proto.kind_case()) {
+        case Value::KindCase::kStringValue: {
+            return ProtoValue(std::move(*proto.mutable_string_value()));
+        }
+        case Value::KindCase::kListValue: {
+            auto* values = proto.mutable_list_value()->mutable_values();
+            ProtoList vec;
+            vec.reserve(values->size());
+            for (Value& list_val : *values) {
+                vec.push_back(from_proto(std::move(list_val)));
+            }
+
+            return ProtoValue(std::move(vec));
+        }
+        case Value::KindCase::kStructValue: {
+            return ProtoValue(from_proto(std::move(*proto.mutable_struct_value())));
+        }
+        default:
+            // Nothing to move out of the remaining kinds.
+            return proto_convert_details::from_proto_impl<Value>{}(&proto);
+    }
+}
+
+ProtoStruct from_proto(Struct&& proto) {  // NOLINT(misc-no-recursion)
+    return impl::from_proto_fields(std::move(*proto.mutable_fields()));
+}
+
+Value* to_proto(const ProtoValue& value, google::protobuf::Arena* arena) {
+    auto* result = Value::default_instance().New(arena);
+    proto_convert_details::to_proto_impl<ProtoValue>{}(value, result);
+    return result;
+}
+
+Struct* to_proto(const ProtoStruct& value, google::protobuf::Arena* arena) {
+    auto* result = Struct::default_instance().New(arena);
+    proto_convert_details::to_proto_impl<ProtoStruct>{}(value, result);
+    return result;
+}
+
+namespace impl {
+
+void to_proto_fields(const ProtoStruct& s, proto_field_map* fields) {  // NOLINT(misc-no-recursion)
+    for (const auto& kv : s) {
+        proto_convert_details::to_proto_impl<ProtoValue>{}(kv.second, &(*fields)[kv.first]);
+    }
+}
+
+ProtoStruct from_proto_fields(proto_field_map&& fields) {  // NOLINT(misc-no-recursion)
+    ProtoStruct result;
+    result.reserve(fields.size());
+
+    // Map keys are immutable, so only the values can be moved from.
+    for (auto& kv : fields) {
+        result.emplace(kv.first, from_proto(std::move(kv.second)));
+    }
+
+    return result;
+}
+
+}  // namespace impl
+
 }  // namespace sdk
 }  // namespace viam
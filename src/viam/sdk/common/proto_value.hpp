@@ -16,6 +16,7 @@ namespace protobuf {
 // The class below is written so as to keep Value out of the ABI, and as such can be instantiated
 // with Value as an incomplete type.
 
+class Arena;
 class Value;
 class Struct;
 }  // namespace protobuf
@@ -325,6 +326,28 @@ struct from_proto_impl<google::protobuf::Struct> {
 
 }  // namespace proto_convert_details
 
+/// @name Move-aware and arena-aware conversions
+/// @brief Overloads of to_proto and from_proto for ProtoValue and ProtoStruct which avoid copies.
+/// @{
+
+/// @brief Convert a google::protobuf::Value which is no longer needed, moving its strings and
+/// nested values rather than copying them. `proto` is left valid but unspecified.
+ProtoValue from_proto(google::protobuf::Value&& proto);
+
+/// @brief Convert a google::protobuf::Struct which is no longer needed, moving its strings and
+/// nested values rather than copying them. `proto` is left valid but unspecified.
+ProtoStruct from_proto(google::protobuf::Struct&& proto);
+
+/// @brief Convert a ProtoValue to a google::protobuf::Value allocated, along with all of its
+/// nested messages, on `arena`. The result is owned by `arena`.
+google::protobuf::Value* to_proto(const ProtoValue& value, google::protobuf::Arena* arena);
+
+/// @brief Convert a ProtoStruct to a google::protobuf::Struct allocated, along with all of its
+/// nested messages, on `arena`. The result is owned by `arena`.
+google::protobuf::Struct* to_proto(const ProtoStruct& value, google::protobuf::Arena* arena);
+
+/// @}
+
 namespace proto_value_details {
 
 void to_value(std::nullptr_t, google::protobuf::Value* v);
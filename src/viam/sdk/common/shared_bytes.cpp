@@ -0,0 +1,74 @@
+#include <viam/sdk/common/shared_bytes.hpp>
+
+#include <algorithm>
+#include <utility>
+
+namespace viam {
+namespace sdk {
+
+SharedBytes::SharedBytes(std::vector<unsigned char> bytes) {
+    if (bytes.empty()) {
+        return;
+    }
+
+    auto owner = std::make_shared<std::vector<unsigned char>>(std::move(bytes));
+    data_ = owner->data();
+    size_ = owner->size();
+    owner_ = std::move(owner);
+}
+
+SharedBytes::SharedBytes(std::initializer_list<unsigned char> bytes)
+    : SharedBytes(std::vector<unsigned char>(bytes)) {}
+
+SharedBytes::SharedBytes(std::string bytes) {
+    if (bytes.empty()) {
+        return;
+    }
+
+    auto owner = std::make_shared<std::string>(std::move(bytes));
+    data_ = reinterpret_cast<const unsigned char*>(owner->data());
+    size_ = owner->size();
+    string_ = owner.get();
+    owner_ = std::move(owner);
+}
+
+SharedBytes::SharedBytes(std::shared_ptr<const void> owner,
+                         const unsigned char* data,
+                         std::size_t size)
+    : owner_(std::move(owner)), data_(data), size_(size) {}
+
+std::vector<unsigned char> SharedBytes::to_vector() const {
+    return {begin(), end()};
+}
+
+std::string SharedBytes::to_string() const {
+    return {reinterpret_cast<const char*>(data_), size_};
+}
+
+std::string SharedBytes::release_string() {
+    std::string result;
+    if (string_ && owner_.use_count() == 1) {
+        result = std::move(*string_);
+    } else {
+        result = to_string();
+    }
+
+    *this = SharedBytes();
+    return result;
+}
+
+bool operator==(const SharedBytes& lhs, const SharedBytes& rhs) {
+    return lhs.size() == rhs.size() &&
+           (lhs.data() == rhs.data() || std::equal(lhs.begin(), lhs.end(), rhs.begin()));
+}
+
+bool operator==(const SharedBytes& lhs, const std::vector<unsigned char>& rhs) {
+    return lhs.size() == rhs.size() && std::equal(lhs.begin(), lhs.end(), rhs.begin());
+}
+
+bool operator==(const std::vector<unsigned char>& lhs, const SharedBytes& rhs) {
+    return rhs == lhs;
+}
+
+}  // namespace sdk
+}  // namespace viam
@@ -0,0 +1,95 @@
+/// @file common/shared_bytes.hpp
+///
+/// @brief Defines `SharedBytes`, a reference-counted immutable byte buffer.
+#pragma once
+
+#include <cstddef>
+#include <initializer_list>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace viam {
+namespace sdk {
+
+/// @class SharedBytes shared_bytes.hpp "common/shared_bytes.hpp"
+/// @brief An immutable, reference-counted sequence of bytes.
+///
+/// Copying a `SharedBytes` shares the underlying storage rather than duplicating it, which makes it
+/// suitable for large payloads such as image frames, point clouds and meshes. The storage can be
+/// adopted without copying from a `std::vector<unsigned char>`, from a `std::string` (for
+/// instance, one moved out of a protobuf `bytes` field), or from any reference-counted owner which
+/// keeps the bytes alive.
+class SharedBytes {
+   public:
+    using value_type = unsigned char;
+    using size_type = std::size_t;
+    using const_iterator = const unsigned char*;
+    using iterator = const_iterator;
+
+    /// @brief Constructs an empty buffer.
+    SharedBytes() = default;
+
+    /// @brief Adopts the storage of @p bytes without copying.
+    SharedBytes(std::vector<unsigned char> bytes);  // NOLINT(google-explicit-constructor)
+
+    /// @brief Constructs a buffer holding a copy of @p bytes.
+    SharedBytes(std::initializer_list<unsigned char> bytes);
+
+    /// @brief Adopts the storage of @p bytes without copying.
+    explicit SharedBytes(std::string bytes);
+
+    /// @brief Refers to @p size bytes at @p data, which are kept alive by @p owner.
+    SharedBytes(std::shared_ptr<const void> owner, const unsigned char* data, std::size_t size);
+
+    const unsigned char* data() const noexcept {
+        return data_;
+    }
+
+    std::size_t size() const noexcept {
+        return size_;
+    }
+
+    bool empty() const noexcept {
+        return size_ == 0;
+    }
+
+    const_iterator begin() const noexcept {
+        return data_;
+    }
+
+    const_iterator end() const noexcept {
+        return data_ + size_;
+    }
+
+    unsigned char operator[](std::size_t i) const noexcept {
+        return data_[i];
+    }
+
+    /// @brief Returns a copy of the bytes as a vector.
+    std::vector<unsigned char> to_vector() const;
+
+    /// @brief Returns a copy of the bytes as a string.
+    std::string to_string() const;
+
+    /// @brief Returns the bytes as a string, leaving this buffer empty.
+    ///
+    /// If this buffer is the only reference to storage which was adopted from a `std::string`, the
+    /// string is moved out without copying. Otherwise the bytes are copied.
+    std::string release_string();
+
+   private:
+    std::shared_ptr<const void> owner_;
+    const unsigned char* data_ = nullptr;
+    std::size_t size_ = 0;
+
+    // Non-null iff `owner_` is a string adopted by this buffer, spanning exactly the viewed bytes.
+    std::string* string_ = nullptr;
+};
+
+bool operator==(const SharedBytes& lhs, const SharedBytes& rhs);
+bool operator==(const SharedBytes& lhs, const std::vector<unsigned char>& rhs);
+bool operator==(const std::vector<unsigned char>& lhs, const SharedBytes& rhs);
+
+}  // namespace sdk
+}  // namespace viam
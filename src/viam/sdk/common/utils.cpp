@@ -97,6 +97,8 @@ std::string bytes_to_string(const std::vector<unsigned char>& b) {
 
 namespace {
 
+constexpr char k_from_data_management[] = "fromDataManagement";
+
 std::string random_debug_key() {
     static const char alphanum[] = "abcdefghijklmnopqrstuvwxyz";
     static std::default_random_engine generator(
@@ -145,7 +147,9 @@ ProtoStruct with_debug_entry(ProtoStruct&& map) {
 }
 
 bool from_dm_from_extra(const ProtoStruct& extra) {
-    auto pos = extra.find("fromDataManagement");
+    // A static key, so that looking it up does not build a std::string on every call.
+    static const std::string key = k_from_data_management;
+    auto pos = extra.find(key);
     if (pos != extra.end()) {
         const ProtoValue& value = pos->second;
 
@@ -153,6 +157,10 @@ bool from_dm_from_extra(const ProtoStruct& extra) {
     }
     return false;
 }
+
+bool from_dm_from_extra(const ProtoStructView& extra) {
+    return extra.get_bool(k_from_data_management).value_or(false);
+}
 std::pair<std::string, std::string> long_name_to_remote_and_short(const std::string& long_name) {
     std::vector<std::string> name_parts;
     // boost::split causes a clang-tidy false positive, see
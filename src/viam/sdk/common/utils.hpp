@@ -6,6 +6,7 @@
 #include <boost/optional/optional.hpp>
 
 #include <viam/sdk/common/proto_convert.hpp>
+#include <viam/sdk/common/proto_struct_view.hpp>
 #include <viam/sdk/common/proto_value.hpp>
 #include <viam/sdk/components/component.hpp>
 #include <viam/sdk/resource/resource_api.hpp>
@@ -115,6 +116,11 @@ ProtoStruct with_debug_entry(ProtoStruct&& map);
 /// @param extra The extra ProtoStruct.
 bool from_dm_from_extra(const ProtoStruct& extra);
 
+/// @brief Get the 'fromDataManagement' value from a view of an extra struct, without converting
+/// it to a ProtoStruct.
+/// @param extra The view of the extra struct.
+bool from_dm_from_extra(const ProtoStructView& extra);
+
 /// @brief Wrapper around std::getenv for obtaining environment variables.
 /// @return The value of the environment variable with name @param var, if set.
 /// @remark std::getenv is inherently racy as the environment variable may be modified outside the
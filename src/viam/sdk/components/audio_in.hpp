@@ -58,6 +58,9 @@ class AudioIn : public Component {
     /// @param chunk_handler callback function to call when an audio response is received.
     /// For an infinite stream this should return true to keep streaming audio and false to indicate
     /// that the stream should terminate. The callback function should not be blocking.
+    /// A handler may move the buffers out of the chunk to keep them; buffers it leaves in place
+    /// are reused for the next chunk. Likewise the SDK's server copies each chunk out without
+    /// moving from it, so implementations may refill the same chunk for every call.
     /// @param duration_seconds duration of audio stream. If zero, stream duration is indefinite.
     /// @param previous_timestamp timestamp to start the audio stream from for continuity between
     /// multiple calls. If zero, will stream data
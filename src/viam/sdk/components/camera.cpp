@@ -1,10 +1,14 @@
 #include <viam/sdk/components/camera.hpp>
 
+#include <array>
+
 #include <google/protobuf/descriptor.h>
 #include <google/protobuf/util/time_util.h>
 
 #include <viam/sdk/common/exception.hpp>
 #include <viam/sdk/common/mime_types.hpp>
+#include <viam/sdk/common/private/byteswap.hpp>
+#include <viam/sdk/common/private/future.hpp>
 #include <viam/sdk/common/utils.hpp>
 #include <viam/sdk/resource/resource.hpp>
 
@@ -18,6 +22,12 @@ API Camera::api() const {
     return API::get<Camera>();
 }
 
+std::future<Camera::image_collection> Camera::get_images_async(
+    std::vector<std::string> filter_source_names, const ProtoStruct& extra) {
+    return impl::make_ready_future(
+        [&] { return get_images(std::move(filter_source_names), extra); });
+}
+
 API API::traits<Camera>::api() {
     return {kRDK, kComponent, "camera"};
 }
@@ -43,13 +53,13 @@ void append_big_endian(std::vector<unsigned char>& data, size_t* offset, T value
 // Reads an int of type T from data in big-endian format and updates the offset.
 // Intended to be used in a sequential manner.
 template <typename T>
-T read_big_endian(const std::vector<unsigned char>& data, size_t* offset) {
-    if (data.size() < *offset + sizeof(T)) {
+T read_big_endian(const unsigned char* data, size_t size, size_t* offset) {
+    if (size < *offset + sizeof(T)) {
         throw std::runtime_error("Attempted to read beyond data bounds.");
     }
 
     T value;
-    std::memcpy(&value, &data[*offset], sizeof(T));
+    std::memcpy(&value, data + *offset, sizeof(T));
     value = boost::endian::big_to_native(value);
     *offset += sizeof(T);
 
@@ -75,49 +85,61 @@ std::vector<unsigned char> Camera::encode_depth_map(const Camera::depth_map& m)
     append_big_endian(data, &offset, width);
     append_big_endian(data, &offset, height);
 
-    for (size_t i = 0; i < height; ++i) {
-        for (size_t j = 0; j < width; ++j) {
-            append_big_endian(data, &offset, m(i, j));
-        }
-    }
+    // `depth_map` is always row-major, so its storage is already in the order we want.
+    impl::copy_big_endian_16(m.data(), data.data() + offset, height * width);
 
     return data;
 }
 
 Camera::depth_map Camera::decode_depth_map(const std::vector<unsigned char>& data) {
-    if (data.size() < k_header_size) {
+    depth_map m;
+    decode_depth_map(data.data(), data.size(), m);
+    return m;
+}
+
+Camera::depth_map_view Camera::view_depth_map(const unsigned char* data, std::size_t size) {
+    if (size < k_header_size) {
         throw Exception("Data too short to contain valid depth information. Size: " +
-                        std::to_string(data.size()));
+                        std::to_string(size));
     }
 
     size_t offset = 0;
-    const uint64_t magic_number = read_big_endian<uint64_t>(data, &offset);
+    const uint64_t magic_number = read_big_endian<uint64_t>(data, size, &offset);
     if (magic_number != k_magic_number) {
         throw Exception(
             "Invalid header for a vnd.viam.dep encoded depth image. The data may be corrupted, or "
             "is not a Viam-encoded depth map.");
     }
 
-    const uint64_t width = read_big_endian<uint64_t>(data, &offset);
-    const uint64_t height = read_big_endian<uint64_t>(data, &offset);
+    const uint64_t width = read_big_endian<uint64_t>(data, size, &offset);
+    const uint64_t height = read_big_endian<uint64_t>(data, size, &offset);
 
     const auto expected_size = k_header_size + width * height * sizeof(uint16_t);
-    if (data.size() != expected_size) {
+    if (size != expected_size) {
         throw Exception("Data size does not match width, height, and depth values. Actual size: " +
-                        std::to_string(data.size()) +
+                        std::to_string(size) +
                         ". Expected size: " + std::to_string(expected_size) +
                         ". Width: " + std::to_string(width) + " Height: " + std::to_string(height));
     }
 
-    std::vector<uint16_t> depth_values;
-    depth_values.reserve(width * height);
-    for (size_t i = 0; i < width * height; ++i) {
-        depth_values.push_back(read_big_endian<uint16_t>(data, &offset));
-    }
+    return {height, width, data + offset};
+}
 
-    xt::xarray<uint16_t> m = xt::xarray<uint16_t>::from_shape({height, width});
-    std::copy(depth_values.begin(), depth_values.end(), m.begin());
-    return m;
+Camera::depth_map_view Camera::view_depth_map(const SharedBytes& data) {
+    return view_depth_map(data.data(), data.size());
+}
+
+void Camera::decode_depth_map(const unsigned char* data, std::size_t size, depth_map& out) {
+    const depth_map_view view = view_depth_map(data, size);
+
+    // Resizing to the same number of elements keeps the existing storage.
+    const std::array<std::size_t, 2> shape{{view.height, view.width}};
+    out.resize(shape);
+    view.copy_to(out.data());
+}
+
+void Camera::depth_map_view::copy_to(std::uint16_t* out) const {
+    impl::copy_big_endian_16(values, out, height * width);
 }
 
 std::string Camera::normalize_mime_type(const std::string& str) {
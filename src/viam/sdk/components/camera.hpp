@@ -5,6 +5,10 @@
 
 #include <bitset>
 #include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <future>
 #include <string>
 #include <vector>
 
@@ -19,6 +23,7 @@
 #include <viam/sdk/common/linear_algebra.hpp>
 #include <viam/sdk/common/mime_types.hpp>
 #include <viam/sdk/common/proto_value.hpp>
+#include <viam/sdk/common/shared_bytes.hpp>
 #include <viam/sdk/common/utils.hpp>
 #include <viam/sdk/config/resource.hpp>
 #include <viam/sdk/resource/resource_api.hpp>
@@ -89,7 +94,7 @@ class Camera : public Component {
     // TODO: update documentation to show how to deserialize a `point_cloud`
     struct point_cloud {
         std::string mime_type;
-        std::vector<unsigned char> pc;
+        SharedBytes pc;
     };
 
     const static std::string lazy_suffix;
@@ -99,7 +104,7 @@ class Camera : public Component {
     // TODO: update documentaiton to show how to deserialize a `raw_image`
     struct raw_image {
         std::string mime_type;
-        std::vector<unsigned char> bytes;
+        SharedBytes bytes;
         std::string source_name;
     };
 
@@ -148,6 +153,52 @@ class Camera : public Component {
     ///         or if the data size does not match the expected size based on the width and height.
     static Camera::depth_map decode_depth_map(const std::vector<unsigned char>& data);
 
+    /// @struct depth_map_view
+    /// @brief A non-owning view of the depth values in FORMAT_RAW_DEPTH data.
+    ///
+    /// Depth values are read from the encoded bytes on access, without decoding the whole map.
+    /// The view is only valid for as long as the bytes it was created from.
+    struct depth_map_view {
+        std::size_t height;
+        std::size_t width;
+
+        /// @brief The big-endian depth values, in row-major order.
+        const unsigned char* values;
+
+        /// @brief Returns the depth value at the given row and column.
+        std::uint16_t operator()(std::size_t row, std::size_t col) const {
+            std::uint16_t value;
+            std::memcpy(&value, values + (row * width + col) * sizeof(value), sizeof(value));
+            return boost::endian::big_to_native(value);
+        }
+
+        /// @brief Decodes every depth value into @p out, which must have room for
+        /// `height * width` values.
+        void copy_to(std::uint16_t* out) const;
+    };
+
+    /// Validates FORMAT_RAW_DEPTH data and returns a view of its depth values, without copying.
+    ///
+    /// @param data Pointer to the encoded depth map.
+    /// @param size The number of bytes at @p data.
+    /// @throws Exception: under the same conditions as `decode_depth_map`.
+    static depth_map_view view_depth_map(const unsigned char* data, std::size_t size);
+
+    /// Validates FORMAT_RAW_DEPTH data and returns a view of its depth values, without copying.
+    ///
+    /// @param data The encoded depth map, which must outlive the returned view.
+    /// @throws Exception: under the same conditions as `decode_depth_map`.
+    static depth_map_view view_depth_map(const SharedBytes& data);
+
+    /// Decodes FORMAT_RAW_DEPTH data into a caller-provided depth map.
+    ///
+    /// @p out is reshaped to the dimensions of the encoded map. Its storage is reused when it
+    /// already holds the same number of values, so decoding a stream of same-sized frames into
+    /// one depth map does not allocate.
+    ///
+    /// @throws Exception: under the same conditions as `decode_depth_map`.
+    static void decode_depth_map(const unsigned char* data, std::size_t size, depth_map& out);
+
     /// @brief remove any extra suffix's from the mime type string.
     static std::string normalize_mime_type(const std::string& str);
 
@@ -185,6 +236,23 @@ class Camera : public Component {
     virtual image_collection get_images(std::vector<std::string> filter_source_names,
                                         const ProtoStruct& extra) = 0;
 
+    /// @brief Starts getting the next images from the camera.
+    /// @return A future which becomes ready with the images and associated response metadata.
+    inline std::future<image_collection> get_images_async() {
+        return get_images_async({}, {});
+    }
+
+    /// @brief Starts getting the next images from the camera.
+    /// @param filter_source_names the names of sources to receive images from. If empty, all
+    /// sources are returned.
+    /// @param extra any additional arguments to the method.
+    /// @return A future which becomes ready with the images and associated response metadata, or
+    /// with the exception thrown while getting them.
+    /// @remark Camera clients make the call without blocking. The default implementation calls
+    /// `get_images` before returning.
+    virtual std::future<image_collection> get_images_async(
+        std::vector<std::string> filter_source_names, const ProtoStruct& extra);
+
     /// @brief Get the next `point_cloud` from the camera.
     /// @param mime_type the desired mime_type of the point_cloud (does not guarantee output type).
     /// @return The requested `point_cloud`.
@@ -1,6 +1,7 @@
 #include <viam/sdk/components/encoder.hpp>
 
 #include <viam/sdk/common/exception.hpp>
+#include <viam/sdk/common/private/future.hpp>
 #include <viam/sdk/common/utils.hpp>
 #include <viam/sdk/resource/resource.hpp>
 
@@ -17,6 +18,11 @@ API API::traits<Encoder>::api() {
 
 Encoder::Encoder(std::string name) : Component(std::move(name)) {}
 
+std::future<Encoder::position> Encoder::get_position_async(const ProtoStruct& extra,
+                                                           position_type position_type) {
+    return impl::make_ready_future([&] { return get_position(extra, position_type); });
+}
+
 bool operator==(const Encoder::position& lhs, const Encoder::position& rhs) {
     return (lhs.value == rhs.value && lhs.type == rhs.type);
 }
@@ -3,6 +3,7 @@
 /// @brief Defines a `Encoder` component.
 #pragma once
 
+#include <future>
 #include <string>
 
 #include <viam/sdk/common/proto_value.hpp>
@@ -62,6 +63,24 @@ class Encoder : public Component {
     virtual position get_position(const ProtoStruct& extra,
                                   position_type position_type = position_type::unspecified) = 0;
 
+    /// @brief Starts getting the position of the encoder.
+    /// @param position_type The type of position you are requesting.
+    /// @return A future which becomes ready with the position.
+    inline std::future<position> get_position_async(
+        position_type position_type = position_type::unspecified) {
+        return get_position_async({}, position_type);
+    }
+
+    /// @brief Starts getting the position of the encoder.
+    /// @param extra Any additional arguments to the method.
+    /// @param position_type The type of position you are requesting.
+    /// @return A future which becomes ready with the position, or with the exception thrown while
+    /// getting it.
+    /// @remark Encoder clients make the call without blocking. The default implementation calls
+    /// `get_position` before returning.
+    virtual std::future<position> get_position_async(
+        const ProtoStruct& extra, position_type position_type = position_type::unspecified);
+
     /// @brief Reset the value of the position
     inline void reset_position() {
         return reset_position({});
@@ -0,0 +1,216 @@
+#include <viam/sdk/components/frame_pipeline.hpp>
+
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <utility>
+
+#include <viam/sdk/rpc/private/executor.hpp>
+
+namespace viam {
+namespace sdk {
+
+struct FramePipeline::impl {
+    // A completed request: either a set of images or the exception which `get_images` threw.
+    struct entry {
+        Camera::image_collection images;
+        std::exception_ptr error;
+    };
+
+    impl(std::shared_ptr<Camera> camera_, options opts_)
+        : camera(std::move(camera_)),
+          opts(std::move(opts_)),
+          capacity(opts.delivery == options::delivery_mode::k_every_frame
+                       ? std::max({opts.queue_capacity, opts.in_flight, std::size_t{1}})
+                       : std::max(opts.queue_capacity, std::size_t{1})) {}
+
+    // Body of each background thread: issues requests back to back until the pipeline stops.
+    void run() {
+        std::unique_lock<std::mutex> lock(mutex);
+        while (true) {
+            if (opts.delivery == options::delivery_mode::k_every_frame) {
+                // Reserve a queue slot before asking for the frame, so that it can't be dropped.
+                room_cv.wait(lock,
+                             [this] { return stopping || queue.size() + outstanding < capacity; });
+            }
+            if (stopping) {
+                return;
+            }
+            ++outstanding;
+
+            lock.unlock();
+            entry result;
+            try {
+                result.images = camera->get_images(opts.filter_source_names, opts.extra);
+            } catch (...) {
+                result.error = std::current_exception();
+            }
+            lock.lock();
+
+            --outstanding;
+            const bool failed = static_cast<bool>(result.error);
+            push_(std::move(result));
+
+            if (failed) {
+                room_cv.wait_for(lock, opts.retry_interval, [this] { return stopping; });
+            }
+        }
+    }
+
+    boost::optional<frame> pop(std::unique_lock<std::mutex>& lock) {
+        if (queue.empty()) {
+            return boost::none;
+        }
+
+        entry next = std::move(queue.front());
+        queue.pop_front();
+        lock.unlock();
+        room_cv.notify_all();
+
+        if (next.error) {
+            std::rethrow_exception(next.error);
+        }
+
+        frame result;
+        result.images = std::move(next.images);
+
+        const time_pt captured_at = result.images.metadata.captured_at;
+        const bool timed = captured_at != time_pt{};
+        if (timed) {
+            result.latency = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::system_clock::now() - captured_at);
+        }
+
+        lock.lock();
+        ++counters.frames_delivered;
+        if (timed) {
+            ++latency_samples;
+            total_latency += result.latency;
+            counters.last_latency = result.latency;
+            counters.max_latency = std::max(counters.max_latency, result.latency);
+        }
+        return result;
+    }
+
+    void stop() {
+        std::unique_ptr<sdk::impl::Executor> workers;
+        {
+            const std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+            workers = std::move(executor);
+        }
+        room_cv.notify_all();
+        frame_cv.notify_all();
+
+        // Joins the background threads once their current requests complete.
+        workers.reset();
+    }
+
+    std::shared_ptr<Camera> camera;
+    const options opts;
+    const std::size_t capacity;
+
+    std::mutex mutex;
+    std::condition_variable frame_cv;
+    std::condition_variable room_cv;
+    std::deque<entry> queue;
+    std::size_t outstanding{0};
+    bool stopping{false};
+
+    // The newest capture time queued or delivered, used to drop stale frames in latest-frame mode.
+    time_pt newest{};
+
+    stats counters;
+    std::uint64_t latency_samples{0};
+    std::chrono::nanoseconds total_latency{0};
+
+    std::unique_ptr<sdk::impl::Executor> executor;
+
+   private:
+    void push_(entry result) {
+        if (result.error) {
+            ++counters.errors;
+        }
+
+        if (opts.delivery == options::delivery_mode::k_latest_frame) {
+            // An error must not push out a good frame, and a good frame supersedes the errors
+            // before it, so errors are only delivered while there is no frame to deliver. They are
+            // still counted in the stats.
+            const auto is_error = [](const entry& queued) {
+                return static_cast<bool>(queued.error);
+            };
+            if (result.error) {
+                if (!std::all_of(queue.begin(), queue.end(), is_error)) {
+                    return;
+                }
+            } else {
+                const time_pt captured_at = result.images.metadata.captured_at;
+                if (captured_at != time_pt{}) {
+                    // With several requests in flight, an older frame can arrive after a newer one.
+                    if (captured_at < newest) {
+                        ++counters.frames_dropped;
+                        return;
+                    }
+                    newest = captured_at;
+                }
+                queue.erase(std::remove_if(queue.begin(), queue.end(), is_error), queue.end());
+            }
+
+            if (queue.size() >= capacity) {
+                queue.pop_front();
+                ++counters.frames_dropped;
+            }
+        }
+
+        queue.push_back(std::move(result));
+        frame_cv.notify_one();
+    }
+};
+
+FramePipeline::FramePipeline(std::shared_ptr<Camera> camera)
+    : FramePipeline(std::move(camera), options{}) {}
+
+FramePipeline::FramePipeline(std::shared_ptr<Camera> camera, options opts)
+    : pimpl_(std::make_unique<impl>(std::move(camera), std::move(opts))) {
+    const std::size_t threads = std::max(pimpl_->opts.in_flight, std::size_t{1});
+    pimpl_->executor = std::make_unique<sdk::impl::Executor>(threads);
+    impl* const state = pimpl_.get();
+    for (std::size_t i = 0; i < threads; ++i) {
+        pimpl_->executor->post([state] { state->run(); });
+    }
+}
+
+FramePipeline::~FramePipeline() {
+    stop();
+}
+
+boost::optional<FramePipeline::frame> FramePipeline::next() {
+    std::unique_lock<std::mutex> lock(pimpl_->mutex);
+    pimpl_->frame_cv.wait(lock, [this] { return pimpl_->stopping || !pimpl_->queue.empty(); });
+    return pimpl_->pop(lock);
+}
+
+boost::optional<FramePipeline::frame> FramePipeline::next(std::chrono::milliseconds timeout) {
+    std::unique_lock<std::mutex> lock(pimpl_->mutex);
+    pimpl_->frame_cv.wait_for(
+        lock, timeout, [this] { return pimpl_->stopping || !pimpl_->queue.empty(); });
+    return pimpl_->pop(lock);
+}
+
+void FramePipeline::stop() {
+    pimpl_->stop();
+}
+
+FramePipeline::stats FramePipeline::get_stats() const {
+    const std::lock_guard<std::mutex> lock(pimpl_->mutex);
+    stats result = pimpl_->counters;
+    if (pimpl_->latency_samples > 0) {
+        result.mean_latency = pimpl_->total_latency / pimpl_->latency_samples;
+    }
+    return result;
+}
+
+}  // namespace sdk
+}  // namespace viam
@@ -0,0 +1,128 @@
+/// @file components/frame_pipeline.hpp
+///
+/// @brief Defines `FramePipeline`, which prefetches images from a `Camera`.
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <boost/optional/optional.hpp>
+
+#include <viam/sdk/common/proto_value.hpp>
+#include <viam/sdk/components/camera.hpp>
+
+namespace viam {
+namespace sdk {
+
+/// @class FramePipeline frame_pipeline.hpp "components/frame_pipeline.hpp"
+/// @brief Fetches images from a `Camera` in the background, ahead of their use.
+/// @ingroup Camera
+///
+/// A loop which calls `Camera::get_images` and then processes the result spends the network round
+/// trip idle. A `FramePipeline` instead keeps `options::in_flight` calls to `get_images` running on
+/// background threads and queues their results, so that fetching the next frame overlaps with
+/// processing the current one.
+///
+/// With more than one request in flight, `get_images` is called concurrently, which the camera must
+/// support. Camera clients obtained from a `RobotClient` do.
+class FramePipeline {
+   public:
+    /// @struct options
+    /// @brief Controls how frames are fetched and delivered.
+    struct options {
+        /// @brief What to do with frames which arrive faster than they are consumed.
+        enum class delivery_mode {
+            /// @brief Keep only the newest frames, dropping the oldest queued frame to make room.
+            /// Frames captured before one already delivered are dropped as stale. A failed
+            /// request is reported by `next` only if no frame is queued, and a frame which arrives
+            /// afterwards replaces it.
+            k_latest_frame,
+
+            /// @brief Deliver every frame, pausing requests while the queue is full.
+            k_every_frame,
+        };
+
+        delivery_mode delivery = delivery_mode::k_latest_frame;
+
+        /// @brief The number of `get_images` calls to keep running at once.
+        std::size_t in_flight = 2;
+
+        /// @brief The maximum number of frames waiting to be consumed. In every-frame mode the
+        /// queue always has room for at least `in_flight` frames.
+        std::size_t queue_capacity = 1;
+
+        /// @brief How long to wait before retrying after `get_images` fails.
+        std::chrono::milliseconds retry_interval{100};
+
+        /// @brief Passed to each `get_images` call.
+        std::vector<std::string> filter_source_names;
+
+        /// @brief Passed to each `get_images` call.
+        ProtoStruct extra;
+    };
+
+    /// @struct frame
+    /// @brief A set of images handed out by the pipeline.
+    struct frame {
+        Camera::image_collection images;
+
+        /// @brief The time from `response_metadata::captured_at` until the frame was returned by
+        /// `next`, or zero if the camera did not report a capture time. This compares clocks on
+        /// the camera's host and on this one, so it is only meaningful if they are synchronized.
+        std::chrono::nanoseconds latency{0};
+    };
+
+    /// @struct stats
+    /// @brief Counters describing the pipeline so far.
+    struct stats {
+        std::uint64_t frames_delivered = 0;
+        std::uint64_t frames_dropped = 0;
+        std::uint64_t errors = 0;
+
+        /// @brief Capture-to-delivery latency over the delivered frames which had a capture time.
+        std::chrono::nanoseconds last_latency{0};
+        std::chrono::nanoseconds mean_latency{0};
+        std::chrono::nanoseconds max_latency{0};
+    };
+
+    /// @brief Starts fetching frames from @p camera with default options.
+    explicit FramePipeline(std::shared_ptr<Camera> camera);
+
+    /// @brief Starts fetching frames from @p camera.
+    FramePipeline(std::shared_ptr<Camera> camera, options opts);
+
+    /// @brief Stops the pipeline, waiting for requests which are still running to complete.
+    ~FramePipeline();
+
+    FramePipeline(const FramePipeline&) = delete;
+    FramePipeline& operator=(const FramePipeline&) = delete;
+
+    /// @brief Waits for and returns the next frame.
+    /// @return The next frame, or `boost::none` once the pipeline has been stopped and every frame
+    /// queued before then has been consumed.
+    /// @throws The exception thrown by `get_images`, if the request behind this frame failed.
+    boost::optional<frame> next();
+
+    /// @brief Waits up to @p timeout for the next frame.
+    /// @return The next frame, or `boost::none` if none arrived in time or the pipeline is stopped
+    /// and empty.
+    /// @throws The exception thrown by `get_images`, if the request behind this frame failed.
+    boost::optional<frame> next(std::chrono::milliseconds timeout);
+
+    /// @brief Stops issuing requests and waits for those in flight to complete. Frames which are
+    /// already queued can still be consumed with `next`.
+    void stop();
+
+    stats get_stats() const;
+
+   private:
+    struct impl;
+    std::unique_ptr<impl> pimpl_;
+};
+
+}  // namespace sdk
+}  // namespace viam
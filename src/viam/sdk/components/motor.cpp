@@ -2,6 +2,7 @@
 
 #include <google/protobuf/descriptor.h>
 
+#include <viam/sdk/common/private/future.hpp>
 #include <viam/sdk/common/utils.hpp>
 #include <viam/sdk/resource/resource.hpp>
 
@@ -12,6 +13,10 @@ API Motor::api() const {
     return API::get<Motor>();
 }
 
+std::future<Motor::position> Motor::get_position_async(const ProtoStruct& extra) {
+    return impl::make_ready_future([&] { return get_position(extra); });
+}
+
 API API::traits<Motor>::api() {
     return {kRDK, kComponent, "motor"};
 }
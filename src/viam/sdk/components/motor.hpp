@@ -3,6 +3,7 @@
 /// @brief Defines a `Motor` component.
 #pragma once
 
+#include <future>
 #include <string>
 
 #include <viam/sdk/common/proto_value.hpp>
@@ -133,6 +134,20 @@ class Motor : public Component, public Stoppable {
     /// @throws `Exception` if position reporting is not supported
     virtual position get_position(const ProtoStruct& extra) = 0;
 
+    /// @brief Starts getting the position of the robot's motor relative to its zero position.
+    /// @return A future which becomes ready with the position.
+    inline std::future<position> get_position_async() {
+        return get_position_async({});
+    }
+
+    /// @brief Starts getting the position of the robot's motor relative to its zero position.
+    /// @param extra Any additional arguments to the method
+    /// @return A future which becomes ready with the position, or with the exception thrown while
+    /// getting it.
+    /// @remark Motor clients make the call without blocking. The default implementation calls
+    /// `get_position` before returning.
+    virtual std::future<position> get_position_async(const ProtoStruct& extra);
+
     /// @brief Returns the properties of the motor which comprises the booleans indicating
     /// which optional features the robot's motor supports
     inline properties get_properties() {
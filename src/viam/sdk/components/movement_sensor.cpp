@@ -1,5 +1,6 @@
 #include <viam/sdk/components/movement_sensor.hpp>
 
+#include <viam/sdk/common/private/future.hpp>
 #include <viam/sdk/common/utils.hpp>
 #include <viam/sdk/resource/resource.hpp>
 
@@ -10,6 +11,24 @@ API MovementSensor::api() const {
     return API::get<MovementSensor>();
 }
 
+std::future<Vector3> MovementSensor::get_linear_velocity_async(const ProtoStruct& extra) {
+    return impl::make_ready_future([&] { return get_linear_velocity(extra); });
+}
+
+std::future<Vector3> MovementSensor::get_angular_velocity_async(const ProtoStruct& extra) {
+    return impl::make_ready_future([&] { return get_angular_velocity(extra); });
+}
+
+std::future<MovementSensor::orientation> MovementSensor::get_orientation_async(
+    const ProtoStruct& extra) {
+    return impl::make_ready_future([&] { return get_orientation(extra); });
+}
+
+std::future<MovementSensor::position> MovementSensor::get_position_async(
+    const ProtoStruct& extra) {
+    return impl::make_ready_future([&] { return get_position(extra); });
+}
+
 API API::traits<MovementSensor>::api() {
     return {kRDK, kComponent, "movement_sensor"};
 }
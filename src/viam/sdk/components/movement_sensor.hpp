@@ -3,6 +3,7 @@
 /// @brief Defines a `MovementSensor` component.
 #pragma once
 
+#include <future>
 #include <string>
 
 #include <viam/sdk/common/linear_algebra.hpp>
@@ -84,6 +85,39 @@ class MovementSensor : public Component {
 
     virtual position get_position(const ProtoStruct& extra) = 0;
 
+    /// @name Asynchronous reads
+    /// @brief Each starts the corresponding read and returns a future which becomes ready with its
+    /// result, or with the exception thrown while getting it.
+    /// @remark Movement sensor clients make the calls without blocking. The default
+    /// implementations make the synchronous call before returning.
+    /// @{
+
+    inline std::future<Vector3> get_linear_velocity_async() {
+        return get_linear_velocity_async({});
+    }
+
+    virtual std::future<Vector3> get_linear_velocity_async(const ProtoStruct& extra);
+
+    inline std::future<Vector3> get_angular_velocity_async() {
+        return get_angular_velocity_async({});
+    }
+
+    virtual std::future<Vector3> get_angular_velocity_async(const ProtoStruct& extra);
+
+    inline std::future<orientation> get_orientation_async() {
+        return get_orientation_async({});
+    }
+
+    virtual std::future<orientation> get_orientation_async(const ProtoStruct& extra);
+
+    inline std::future<position> get_position_async() {
+        return get_position_async({});
+    }
+
+    virtual std::future<position> get_position_async(const ProtoStruct& extra);
+
+    /// @}
+
     inline properties get_properties() {
         return get_properties({});
     }
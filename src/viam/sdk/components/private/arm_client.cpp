@@ -259,10 +259,13 @@ ProtoStruct ArmClient::do_command(const ProtoStruct& command) {
 std::map<std::string, mesh> ArmClient::get_3d_models(const ProtoStruct& extra) {
     return make_client_helper(this, *stub_, &StubType::Get3DModels)
         .with(extra)
-        .invoke([](auto& response) {
+        .invoke([](auto&& response) {
             std::map<std::string, mesh> models;
-            for (const auto& entry : response.models()) {
-                models.emplace(entry.first, from_proto(entry.second));
+            for (auto& entry : *response.mutable_models()) {
+                auto& proto = entry.second;
+                models.emplace(entry.first,
+                               mesh{std::move(*proto.mutable_content_type()),
+                                    SharedBytes(std::move(*proto.mutable_mesh()))});
             }
             return models;
         });
@@ -295,10 +295,13 @@ ArmServer::ArmServer(std::shared_ptr<ResourceManager> manager)
                                       ::viam::common::v1::Get3DModelsResponse* response) noexcept {
     return make_service_helper<Arm>(
         "ArmServer::Get3DModels", this, context, request)([&](auto& helper, auto& arm) {
-        const std::map<std::string, mesh> models = arm->get_3d_models(helper.getExtra());
+        std::map<std::string, mesh> models = arm->get_3d_models(helper.getExtra());
 
-        for (const auto& entry : models) {
-            response->mutable_models()->insert({entry.first, to_proto(entry.second)});
+        auto& proto_models = *response->mutable_models();
+        for (auto& entry : models) {
+            auto& proto = proto_models[entry.first];
+            proto.set_content_type(std::move(entry.second.content_type));
+            proto.set_mesh(entry.second.data.release_string());
         }
     });
 }
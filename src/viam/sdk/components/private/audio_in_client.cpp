@@ -33,6 +33,7 @@ void AudioInClient::get_audio(std::string const& codec,
                               double const& duration_seconds,
                               int64_t const& previous_timestamp,
                               const ProtoStruct& extra) {
+    audio_chunk chunk;
     return make_client_helper(this, *stub_, &StubType::GetAudio)
         .with(extra,
               [&](auto& request) {
@@ -41,14 +42,15 @@ void AudioInClient::get_audio(std::string const& codec,
                   request.set_previous_timestamp_nanoseconds(previous_timestamp);
               })
         .invoke_stream([&](auto& response) {
-            // Create audio_chunk struct from proto response
-            audio_chunk chunk;
-
-            // Convert audio_data from string to std::vector<uint8_t>
+            // Unless the handler moves them out, the chunk's buffers are still ours once it
+            // returns, and are refilled in place for the next response.
             const std::string& audio_data_str = response.audio().audio_data();
-            chunk.audio_data.assign(audio_data_str.c_str(),
-                                    audio_data_str.c_str() + audio_data_str.size());
+            chunk.audio_data.assign(audio_data_str.begin(), audio_data_str.end());
 
+            chunk.start_timestamp_ns =
+                std::chrono::nanoseconds(response.audio().start_timestamp_nanoseconds());
+            chunk.end_timestamp_ns =
+                std::chrono::nanoseconds(response.audio().end_timestamp_nanoseconds());
             chunk.sequence_number = response.audio().sequence();
             chunk.request_id = response.request_id();
 
@@ -56,6 +58,8 @@ void AudioInClient::get_audio(std::string const& codec,
                 chunk.info.codec = response.audio().audio_info().codec();
                 chunk.info.sample_rate_hz = response.audio().audio_info().sample_rate_hz();
                 chunk.info.num_channels = response.audio().audio_info().num_channels();
+            } else {
+                chunk.info = audio_info{};
             }
             return chunk_handler(std::move(chunk));
         });
@@ -19,32 +19,33 @@ AudioInServer::AudioInServer(std::shared_ptr<ResourceManager> manager)
     return make_service_helper<AudioIn>(
         "AudioInServer::GetAudio", this, context, request)([&](auto& helper, auto& audio_in) {
         const std::string request_id = boost::uuids::to_string(boost::uuids::random_generator()());
-        auto writeChunk = [writer, context, request_id](AudioIn::audio_chunk&& chunk) {
+
+        // One response is reused for the whole stream. Assigning into its fields reuses the
+        // storage left from the previous chunk, so steady-state streaming does not allocate.
+        ::viam::component::audioin::v1::GetAudioResponse response;
+        auto writeChunk = [writer, &response, context, &request_id](
+                              AudioIn::audio_chunk&& chunk) {
             if (context->IsCancelled()) {
                 // send bool to tell the resource to stop calling the callback function.
                 return false;
             }
-            ::viam::component::audioin::v1::GetAudioResponse response;
             auto* audio_chunk = response.mutable_audio();
 
-            // Convert audio_data from std::vector<uint8_t> to string
-            std::string audio_data_str;
-            audio_data_str.reserve(chunk.audio_data.size());
-            for (const auto& byte : chunk.audio_data) {
-                audio_data_str.push_back(static_cast<char>(byte));
-            }
-            audio_chunk->set_audio_data(std::move(audio_data_str));
+            // The chunk's buffers are left intact, so implementations may reuse them for the
+            // next chunk.
+            audio_chunk->mutable_audio_data()->assign(
+                reinterpret_cast<const char*>(chunk.audio_data.data()), chunk.audio_data.size());
 
             // Set audio_info fields
             auto* audio_info = audio_chunk->mutable_audio_info();
-            audio_info->set_codec(std::move(chunk.info.codec));
+            *audio_info->mutable_codec() = chunk.info.codec;
             audio_info->set_sample_rate_hz(chunk.info.sample_rate_hz);
             audio_info->set_num_channels(chunk.info.num_channels);
 
             audio_chunk->set_start_timestamp_nanoseconds(chunk.start_timestamp_ns.count());
             audio_chunk->set_end_timestamp_nanoseconds(chunk.end_timestamp_ns.count());
             audio_chunk->set_sequence(chunk.sequence_number);
-            response.set_request_id(request_id);
+            *response.mutable_request_id() = request_id;
             writer->Write(response);
             return true;
         };
@@ -51,11 +51,12 @@ void AudioOutClient::play_stream(
         throw GRPCException(&status);
     }
 
-    // Pull chunks from the source and forward each as a PlayStreamChunk message.
+    // Pull chunks from the source and forward each as a PlayStreamChunk message. The message is
+    // reused, so its audio buffer only grows when a chunk is larger than any before it.
+    ::viam::component::audioout::v1::PlayStreamRequest msg;
+    std::string* audio_data = msg.mutable_audio_chunk()->mutable_audio_data();
     while (auto chunk = chunk_source()) {
-        ::viam::component::audioout::v1::PlayStreamRequest msg;
-        auto* chunk_msg = msg.mutable_audio_chunk();
-        chunk_msg->set_audio_data(std::string(chunk->begin(), chunk->end()));
+        audio_data->assign(reinterpret_cast<const char*>(chunk->data()), chunk->size());
         if (!writer->Write(msg)) {
             // Stream broken on server side; surface the error from Finish().
             break;
@@ -75,9 +76,8 @@ void AudioOutClient::play(std::vector<uint8_t> const& audio_data,
     return make_client_helper(this, *stub_, &StubType::Play)
         .with(extra,
               [&](auto& request) {
-                  // Convert audio_data from std::vector<uint8_t> to string
-                  std::string audio_data_str(audio_data.begin(), audio_data.end());
-                  request.set_audio_data(std::move(audio_data_str));
+                  request.mutable_audio_data()->assign(
+                      reinterpret_cast<const char*>(audio_data.data()), audio_data.size());
 
                   if (info) {
                       ::viam::common::v1::AudioInfo* proto_info = request.mutable_audio_info();
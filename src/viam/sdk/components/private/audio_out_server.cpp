@@ -18,10 +18,8 @@ AudioOutServer::AudioOutServer(std::shared_ptr<ResourceManager> manager)
                                     ::viam::component::audioout::v1::PlayResponse*) noexcept {
     return make_service_helper<AudioOut>(
         "AudioOutServer::Play", this, context, request)([&](auto& helper, auto& audio_out) {
-        // Convert audio_data from string to std::vector<uint8_t>
-        std::vector<uint8_t> audio_data;
         const std::string& audio_data_str = request->audio_data();
-        audio_data.assign(audio_data_str.c_str(), audio_data_str.c_str() + audio_data_str.size());
+        const std::vector<uint8_t> audio_data(audio_data_str.begin(), audio_data_str.end());
 
         boost::optional<audio_info> info;
         if (request->has_audio_info()) {
@@ -72,8 +70,10 @@ AudioOutServer::AudioOutServer(std::shared_ptr<ResourceManager> manager)
 
     // chunk_source pulls the next chunk off the gRPC stream. Returns boost::none on EOF or
     // cancellation, signaling end-of-stream to the implementation.
-    auto chunk_source = [reader, context]() -> boost::optional<std::vector<uint8_t>> {
-        ::viam::component::audioout::v1::PlayStreamRequest msg;
+    // The request message is reused across reads so that parsing each chunk reuses the storage of
+    // the last one.
+    ::viam::component::audioout::v1::PlayStreamRequest msg;
+    auto chunk_source = [reader, context, &msg]() -> boost::optional<std::vector<uint8_t>> {
         while (reader->Read(&msg)) {
             if (context->IsCancelled()) {
                 return boost::none;
@@ -23,29 +23,25 @@ namespace impl {
 using sdk::from_proto;
 using sdk::to_proto;
 
-Camera::image_collection from_proto(const viam::component::camera::v1::GetImagesResponse& proto) {
+// Takes the response by rvalue so that image bytes can be adopted rather than copied.
+Camera::image_collection from_proto(viam::component::camera::v1::GetImagesResponse&& proto) {
     Camera::image_collection image_collection;
-    std::vector<Camera::raw_image> images;
-    for (const auto& img : proto.images()) {
+    image_collection.images.reserve(proto.images_size());
+    for (auto& img : *proto.mutable_images()) {
         Camera::raw_image raw_image;
-        std::string img_string = img.image();
-        const std::vector<unsigned char> bytes(img_string.begin(), img_string.end());
-        raw_image.bytes = bytes;
-        raw_image.mime_type = img.mime_type();
-        raw_image.source_name = img.source_name();
-        images.push_back(raw_image);
+        raw_image.bytes = SharedBytes(std::move(*img.mutable_image()));
+        raw_image.mime_type = std::move(*img.mutable_mime_type());
+        raw_image.source_name = std::move(*img.mutable_source_name());
+        image_collection.images.push_back(std::move(raw_image));
     }
-    image_collection.images = std::move(images);
     image_collection.metadata = from_proto(proto.response_metadata());
     return image_collection;
 }
 
-Camera::point_cloud from_proto(const viam::component::camera::v1::GetPointCloudResponse& proto) {
+Camera::point_cloud from_proto(viam::component::camera::v1::GetPointCloudResponse&& proto) {
     Camera::point_cloud point_cloud;
-    std::string pc_string = proto.point_cloud();
-    const std::vector<unsigned char> bytes(pc_string.begin(), pc_string.end());
-    point_cloud.pc = bytes;
-    point_cloud.mime_type = proto.mime_type();
+    point_cloud.pc = SharedBytes(std::move(*proto.mutable_point_cloud()));
+    point_cloud.mime_type = std::move(*proto.mutable_mime_type());
     return point_cloud;
 }
 
@@ -105,27 +101,47 @@ ProtoStruct CameraClient::do_command(const ProtoStruct& command) {
         .invoke([](auto& response) { return from_proto(response.result()); });
 };
 
+namespace {
+
+void set_filter_source_names(std::vector<std::string>&& filter_source_names,
+                             viam::component::camera::v1::GetImagesRequest& request) {
+    if (!filter_source_names.empty()) {
+        // in newer gRPC versions we would be able to call `Add` or `Assign` on an
+        // iterator range rather than element-wise copy
+        request.mutable_filter_source_names()->Reserve(filter_source_names.size());
+        for (auto& source_name : filter_source_names) {
+            request.add_filter_source_names(std::move(source_name));
+        }
+    }
+}
+
+}  // namespace
+
 Camera::image_collection CameraClient::get_images(std::vector<std::string> filter_source_names,
                                                   const ProtoStruct& extra) {
     return make_client_helper(this, *stub_, &StubType::GetImages)
         .with(extra,
               [&](auto& request) {
-                  if (!filter_source_names.empty()) {
-                      // in newer gRPC versions we would be able to call `Add` or `Assign` on an
-                      // iterator range rather than element-wise copy
-                      request.mutable_filter_source_names()->Reserve(filter_source_names.size());
-                      for (auto& source_name : filter_source_names) {
-                          request.add_filter_source_names(std::move(source_name));
-                      }
-                  }
+                  set_filter_source_names(std::move(filter_source_names), request);
               })
-        .invoke([](auto& response) { return from_proto(response); });
+        .invoke([](auto&& response) { return from_proto(std::move(response)); });
 };
 
+std::future<Camera::image_collection> CameraClient::get_images_async(
+    std::vector<std::string> filter_source_names, const ProtoStruct& extra) {
+    return make_client_helper(this, stub_, &StubType::GetImages)
+        .with(extra,
+              [&](auto& request) {
+                  set_filter_source_names(std::move(filter_source_names), request);
+              })
+        .invoke_async(VIAMCPPSDK_ASYNC_METHOD(StubType, GetImages),
+                      [](auto&& response) { return from_proto(std::move(response)); });
+}
+
 Camera::point_cloud CameraClient::get_point_cloud(std::string mime_type, const ProtoStruct& extra) {
     return make_client_helper(this, *stub_, &StubType::GetPointCloud)
         .with(extra, [&](auto& request) { *request.mutable_mime_type() = mime_type; })
-        .invoke([](auto& response) { return from_proto(response); });
+        .invoke([](auto&& response) { return from_proto(std::move(response)); });
 };
 
 std::vector<GeometryConfig> CameraClient::get_geometries(const ProtoStruct& extra) {
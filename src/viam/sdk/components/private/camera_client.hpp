@@ -36,6 +36,9 @@ class CameraClient : public Camera {
     image_collection get_images(std::vector<std::string> filter_source_names,
                                 const ProtoStruct& extra) override;
 
+    std::future<image_collection> get_images_async(std::vector<std::string> filter_source_names,
+                                                   const ProtoStruct& extra) override;
+
     point_cloud get_point_cloud(std::string mime_type, const ProtoStruct& extra) override;
 
     properties get_properties() override;
@@ -53,6 +56,7 @@ class CameraClient : public Camera {
     // we need to include these `using` lines.
     using Camera::get_geometries;
     using Camera::get_images;
+    using Camera::get_images_async;
     using Camera::get_point_cloud;
 
    protected:
@@ -65,7 +69,7 @@ class CameraClient : public Camera {
 
    private:
     using StubType = viam::component::camera::v1::CameraService::StubInterface;
-    std::unique_ptr<StubType> stub_;
+    std::shared_ptr<StubType> stub_;
     const ViamChannel* channel_;
 };
 
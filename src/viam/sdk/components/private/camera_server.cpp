@@ -66,16 +66,15 @@ CameraServer::CameraServer(std::shared_ptr<ResourceManager> manager)
     ::viam::component::camera::v1::GetImagesResponse* response) noexcept {
     return make_service_helper<Camera>(
         "CameraServer::GetImages", this, context, request)([&](auto& helper, auto& camera) {
-        const Camera::image_collection image_coll = camera->get_images(
+        Camera::image_collection image_coll = camera->get_images(
             {request->filter_source_names().begin(), request->filter_source_names().end()},
             helper.getExtra());
-        for (const auto& img : image_coll.images) {
-            ::viam::component::camera::v1::Image proto_image;
-            const std::string img_string = bytes_to_string(img.bytes);
-            proto_image.set_source_name(img.source_name);
-            proto_image.set_mime_type(img.mime_type);
-            proto_image.set_image(img_string);
-            *response->mutable_images()->Add() = std::move(proto_image);
+        response->mutable_images()->Reserve(static_cast<int>(image_coll.images.size()));
+        for (auto& img : image_coll.images) {
+            auto* proto_image = response->add_images();
+            proto_image->set_source_name(std::move(img.source_name));
+            proto_image->set_mime_type(std::move(img.mime_type));
+            proto_image->set_image(img.bytes.release_string());
         }
         *response->mutable_response_metadata() = to_proto(image_coll.metadata);
     });
@@ -87,10 +86,10 @@ CameraServer::CameraServer(std::shared_ptr<ResourceManager> manager)
     ::viam::component::camera::v1::GetPointCloudResponse* response) noexcept {
     return make_service_helper<Camera>(
         "CameraServer::GetPointCloud", this, context, request)([&](auto& helper, auto& camera) {
-        const Camera::point_cloud point_cloud =
+        Camera::point_cloud point_cloud =
             camera->get_point_cloud(request->mime_type(), helper.getExtra());
         *response->mutable_mime_type() = kMimeTypePCD;
-        *response->mutable_point_cloud() = bytes_to_string(point_cloud.pc);
+        response->set_point_cloud(point_cloud.pc.release_string());
     });
 }
 
@@ -59,6 +59,14 @@ Encoder::position EncoderClient::get_position(const ProtoStruct& extra,
         .invoke([](auto& response) { return from_proto(response); });
 }
 
+std::future<Encoder::position> EncoderClient::get_position_async(const ProtoStruct& extra,
+                                                                 position_type position_type) {
+    return make_client_helper(this, stub_, &StubType::GetPosition)
+        .with(extra, [&](auto& request) { request.set_position_type(to_proto(position_type)); })
+        .invoke_async(VIAMCPPSDK_ASYNC_METHOD(StubType, GetPosition),
+                      [](auto& response) { return from_proto(response); });
+}
+
 void EncoderClient::reset_position(const ProtoStruct& extra) {
     return make_client_helper(this, *stub_, &StubType::ResetPosition).with(extra).invoke();
 }
@@ -25,6 +25,8 @@ class EncoderClient : public Encoder {
         return *channel_;
     }
     position get_position(const ProtoStruct& extra, position_type position_type) override;
+    std::future<position> get_position_async(const ProtoStruct& extra,
+                                             position_type position_type) override;
     void reset_position(const ProtoStruct& extra) override;
     properties get_properties(const ProtoStruct& extra) override;
     std::vector<GeometryConfig> get_geometries(const ProtoStruct& extra) override;
@@ -43,12 +45,13 @@ class EncoderClient : public Encoder {
     // we need to include these `using` lines.
     using Encoder::get_geometries;
     using Encoder::get_position;
+    using Encoder::get_position_async;
     using Encoder::get_properties;
     using Encoder::reset_position;
 
    private:
     using StubType = viam::component::encoder::v1::EncoderService::StubInterface;
-    std::unique_ptr<StubType> stub_;
+    std::shared_ptr<StubType> stub_;
     const ViamChannel* channel_;
 };
 
@@ -88,6 +88,13 @@ Motor::position MotorClient::get_position(const ProtoStruct& extra) {
         .invoke([](auto& response) { return from_proto(response); });
 }
 
+std::future<Motor::position> MotorClient::get_position_async(const ProtoStruct& extra) {
+    return make_client_helper(this, stub_, &StubType::GetPosition)
+        .with(extra)
+        .invoke_async(VIAMCPPSDK_ASYNC_METHOD(StubType, GetPosition),
+                      [](auto& response) { return from_proto(response); });
+}
+
 Motor::properties MotorClient::get_properties(const ProtoStruct& extra) {
     return make_client_helper(this, *stub_, &StubType::GetProperties)
         .with(extra)
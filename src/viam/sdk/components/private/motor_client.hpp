@@ -31,6 +31,7 @@ class MotorClient : public Motor {
     void set_rpm(double rpm, const ProtoStruct& extra) override;
     void reset_zero_position(double offset, const ProtoStruct& extra) override;
     position get_position(const ProtoStruct& extra) override;
+    std::future<position> get_position_async(const ProtoStruct& extra) override;
     properties get_properties(const ProtoStruct& extra) override;
     void stop(const ProtoStruct& extra) override;
     power_status get_power_status(const ProtoStruct& extra) override;
@@ -50,6 +51,7 @@ class MotorClient : public Motor {
     // we need to include these `using` lines.
     using Motor::get_geometries;
     using Motor::get_position;
+    using Motor::get_position_async;
     using Motor::get_power_status;
     using Motor::get_properties;
     using Motor::go_for;
@@ -61,7 +63,7 @@ class MotorClient : public Motor {
 
    private:
     using StubType = viam::component::motor::v1::MotorService::StubInterface;
-    std::unique_ptr<StubType> stub_;
+    std::shared_ptr<StubType> stub_;
     const ViamChannel* channel_;
 };
 
@@ -95,6 +95,36 @@ MovementSensor::position MovementSensorClient::get_position(const ProtoStruct& e
         .invoke([](auto& response) { return from_proto(response); });
 }
 
+std::future<Vector3> MovementSensorClient::get_linear_velocity_async(const ProtoStruct& extra) {
+    return make_client_helper(this, stub_, &StubType::GetLinearVelocity)
+        .with(extra)
+        .invoke_async(VIAMCPPSDK_ASYNC_METHOD(StubType, GetLinearVelocity),
+                      [](auto& response) { return from_proto(response.linear_velocity()); });
+}
+
+std::future<Vector3> MovementSensorClient::get_angular_velocity_async(const ProtoStruct& extra) {
+    return make_client_helper(this, stub_, &StubType::GetAngularVelocity)
+        .with(extra)
+        .invoke_async(VIAMCPPSDK_ASYNC_METHOD(StubType, GetAngularVelocity),
+                      [](auto& response) { return from_proto(response.angular_velocity()); });
+}
+
+std::future<MovementSensor::orientation> MovementSensorClient::get_orientation_async(
+    const ProtoStruct& extra) {
+    return make_client_helper(this, stub_, &StubType::GetOrientation)
+        .with(extra)
+        .invoke_async(VIAMCPPSDK_ASYNC_METHOD(StubType, GetOrientation),
+                      [](auto& response) { return from_proto(response.orientation()); });
+}
+
+std::future<MovementSensor::position> MovementSensorClient::get_position_async(
+    const ProtoStruct& extra) {
+    return make_client_helper(this, stub_, &StubType::GetPosition)
+        .with(extra)
+        .invoke_async(VIAMCPPSDK_ASYNC_METHOD(StubType, GetPosition),
+                      [](auto& response) { return from_proto(response); });
+}
+
 MovementSensor::properties MovementSensorClient::get_properties(const ProtoStruct& extra) {
     return make_client_helper(this, *stub_, &StubType::GetProperties)
         .with(extra)
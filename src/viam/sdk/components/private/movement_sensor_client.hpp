@@ -32,6 +32,10 @@ class MovementSensorClient : public MovementSensor {
     compassheading get_compass_heading(const ProtoStruct& extra) override;
     orientation get_orientation(const ProtoStruct& extra) override;
     position get_position(const ProtoStruct& extra) override;
+    std::future<Vector3> get_linear_velocity_async(const ProtoStruct& extra) override;
+    std::future<Vector3> get_angular_velocity_async(const ProtoStruct& extra) override;
+    std::future<orientation> get_orientation_async(const ProtoStruct& extra) override;
+    std::future<position> get_position_async(const ProtoStruct& extra) override;
     properties get_properties(const ProtoStruct& extra) override;
     std::unordered_map<std::string, float> get_accuracy(const ProtoStruct& extra) override;
     Vector3 get_linear_acceleration(const ProtoStruct& extra) override;
@@ -41,17 +45,21 @@ class MovementSensorClient : public MovementSensor {
 
     using MovementSensor::get_accuracy;
     using MovementSensor::get_angular_velocity;
+    using MovementSensor::get_angular_velocity_async;
     using MovementSensor::get_compass_heading;
     using MovementSensor::get_geometries;
     using MovementSensor::get_linear_acceleration;
     using MovementSensor::get_linear_velocity;
+    using MovementSensor::get_linear_velocity_async;
     using MovementSensor::get_orientation;
+    using MovementSensor::get_orientation_async;
     using MovementSensor::get_position;
+    using MovementSensor::get_position_async;
     using MovementSensor::get_properties;
 
    private:
     using StubType = viam::component::movementsensor::v1::MovementSensorService::StubInterface;
-    std::unique_ptr<StubType> stub_;
+    std::shared_ptr<StubType> stub_;
     const ViamChannel* channel_;
 };
 
@@ -12,6 +12,7 @@
 #include <viam/api/component/powersensor/v1/powersensor.grpc.pb.h>
 
 #include <viam/sdk/common/client_helper.hpp>
+#include <viam/sdk/common/private/proto_value.hpp>
 #include <viam/sdk/common/utils.hpp>
 #include <viam/sdk/components/power_sensor.hpp>
 #include <viam/sdk/config/resource.hpp>
@@ -66,12 +67,8 @@ double PowerSensorClient::get_power(const ProtoStruct& extra) {
 ProtoStruct PowerSensorClient::get_readings(const ProtoStruct& extra) {
     return make_client_helper(this, *stub_, &StubType::GetReadings)
         .with(extra)
-        .invoke([](auto& response) {
-            ProtoStruct result;
-            for (const auto& r : response.readings()) {
-                result.emplace(r.first, from_proto(r.second));
-            }
-            return result;
+        .invoke([](auto&& response) {
+            return impl::from_proto_fields(std::move(*response.mutable_readings()));
         });
 }
 
@@ -1,5 +1,6 @@
 #include <viam/sdk/components/private/power_sensor_server.hpp>
 
+#include <viam/sdk/common/private/proto_value.hpp>
 #include <viam/sdk/common/private/service_helper.hpp>
 #include <viam/sdk/common/utils.hpp>
 #include <viam/sdk/components/power_sensor.hpp>
@@ -68,8 +69,8 @@ PowerSensorServer::PowerSensorServer(std::shared_ptr<ResourceManager> manager)
     return make_service_helper<PowerSensor>(
         "PowerSensorServer::GetReadings", this, context, request)(
         [&](auto& helper, auto& powersensor) {
-            *(response->mutable_readings()) =
-                to_proto(powersensor->get_readings(helper.getExtra())).fields();
+            impl::to_proto_fields(powersensor->get_readings(helper.getExtra()),
+                                  response->mutable_readings());
         });
 }
 
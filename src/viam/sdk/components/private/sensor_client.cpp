@@ -10,6 +10,7 @@
 #include <viam/api/component/sensor/v1/sensor.grpc.pb.h>
 
 #include <viam/sdk/common/client_helper.hpp>
+#include <viam/sdk/common/private/proto_value.hpp>
 #include <viam/sdk/common/utils.hpp>
 #include <viam/sdk/components/sensor.hpp>
 #include <viam/sdk/config/resource.hpp>
@@ -28,12 +29,16 @@ using namespace viam::common::v1;
 ProtoStruct SensorClient::get_readings(const ProtoStruct& extra) {
     return make_client_helper(this, *stub_, &StubType::GetReadings)
         .with(extra)
-        .invoke([](auto& response) {
-            ProtoStruct result;
-            for (const auto& r : response.readings()) {
-                result.emplace(r.first, from_proto(r.second));
-            }
-            return result;
+        .invoke([](auto&& response) {
+            return impl::from_proto_fields(std::move(*response.mutable_readings()));
+        });
+}
+
+std::future<ProtoStruct> SensorClient::get_readings_async(const ProtoStruct& extra) {
+    return make_client_helper(this, stub_, &StubType::GetReadings)
+        .with(extra)
+        .invoke_async(VIAMCPPSDK_ASYNC_METHOD(StubType, GetReadings), [](auto&& response) {
+            return impl::from_proto_fields(std::move(*response.mutable_readings()));
         });
 }
 
@@ -26,16 +26,18 @@ class SensorClient : public Sensor {
         return *channel_;
     }
     ProtoStruct get_readings(const ProtoStruct& extra) override;
+    std::future<ProtoStruct> get_readings_async(const ProtoStruct& extra) override;
     ProtoStruct do_command(const ProtoStruct& command) override;
     ProtoStruct get_status() override;
     std::vector<GeometryConfig> get_geometries(const ProtoStruct& extra) override;
 
     using Sensor::get_geometries;
     using Sensor::get_readings;
+    using Sensor::get_readings_async;
 
    private:
     using StubType = viam::component::sensor::v1::SensorService::StubInterface;
-    std::unique_ptr<StubType> stub_;
+    std::shared_ptr<StubType> stub_;
     const ViamChannel* channel_;
 };
 
@@ -1,5 +1,6 @@
 #include <viam/sdk/components/private/sensor_server.hpp>
 
+#include <viam/sdk/common/private/proto_value.hpp>
 #include <viam/sdk/common/private/service_helper.hpp>
 #include <viam/sdk/common/utils.hpp>
 #include <viam/sdk/components/sensor.hpp>
@@ -20,8 +21,8 @@ SensorServer::SensorServer(std::shared_ptr<ResourceManager> manager)
                                          GetReadingsResponse* response) noexcept {
     return make_service_helper<Sensor>(
         "SensorServer::GetReadings", this, context, request)([&](auto& helper, auto& sensor) {
-        *(response->mutable_readings()) =
-            to_proto(sensor->get_readings(helper.getExtra())).fields();
+        impl::to_proto_fields(sensor->get_readings(helper.getExtra()),
+                              response->mutable_readings());
     });
 }
 
@@ -1,5 +1,7 @@
 #include <viam/sdk/components/sensor.hpp>
 
+#include <viam/sdk/common/private/future.hpp>
+
 namespace viam {
 namespace sdk {
 
@@ -7,6 +9,10 @@ API Sensor::api() const {
     return API::get<Sensor>();
 }
 
+std::future<ProtoStruct> Sensor::get_readings_async(const ProtoStruct& extra) {
+    return impl::make_ready_future([&] { return get_readings(extra); });
+}
+
 API API::traits<Sensor>::api() {
     return {kRDK, kComponent, "sensor"};
 }
@@ -3,6 +3,7 @@
 /// @brief Defines a `Sensor` component.
 #pragma once
 
+#include <future>
 #include <string>
 
 #include <viam/sdk/common/proto_value.hpp>
@@ -54,6 +55,20 @@ class Sensor : public Component {
     /// @return The requested measurements/data specific to this sensor.
     virtual ProtoStruct get_readings(const ProtoStruct& extra) = 0;
 
+    /// @brief Starts getting the measurements/data specific to this sensor.
+    /// @return A future which becomes ready with the readings.
+    inline std::future<ProtoStruct> get_readings_async() {
+        return get_readings_async({});
+    }
+
+    /// @brief Starts getting the measurements/data specific to this sensor.
+    /// @param extra Any additional arguments to the method.
+    /// @return A future which becomes ready with the readings, or with the exception thrown while
+    /// getting them.
+    /// @remark Sensor clients make the call without blocking, so that one thread can read many
+    /// remote sensors at once. The default implementation calls `get_readings` before returning.
+    virtual std::future<ProtoStruct> get_readings_async(const ProtoStruct& extra);
+
    protected:
     explicit Sensor(std::string name) : Component(std::move(name)) {}
 };
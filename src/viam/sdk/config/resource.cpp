@@ -121,25 +121,31 @@ const ProtoStruct& ResourceConfig::attributes() const {
 }
 
 void ResourceConfig::fix_api() {
-    if (this->api_.type_namespace().empty() && this->namespace__.empty()) {
+    std::string api_namespace = this->api_.type_namespace();
+    std::string api_type = this->api_.resource_type();
+    std::string api_subtype = this->api_.resource_subtype();
+
+    if (api_namespace.empty() && this->namespace__.empty()) {
         this->namespace__ = kRDK;
-        this->api_.namespace_ = kRDK;
-    } else if (this->api_.type_namespace().empty()) {
-        api_.namespace_ = namespace__;
+        api_namespace = kRDK;
+    } else if (api_namespace.empty()) {
+        api_namespace = namespace__;
     } else {
-        this->namespace__ = this->api_.type_namespace();
+        this->namespace__ = api_namespace;
     }
 
-    if (this->api_.resource_type().empty()) {
-        api_.resource_type_ = kComponent;
+    if (api_type.empty()) {
+        api_type = kComponent;
     }
 
-    if (this->api_.resource_subtype().empty()) {
-        api_.resource_subtype_ = this->type_;
+    if (api_subtype.empty()) {
+        api_subtype = this->type_;
     } else if (this->type_.empty()) {
-        this->type_ = this->api_.resource_subtype();
+        this->type_ = api_subtype;
     }
 
+    this->api_ = API(std::move(api_namespace), std::move(api_type), std::move(api_subtype));
+
     // This shouldn't be able to happen except with directly instantiated
     // config structs
     if (this->api_.type_namespace() != this->namespace__ ||
@@ -139,6 +139,20 @@ void LogManager::set_resource_log_level(const std::string& resource, log_level l
     resource_levels_[resource] = lvl;
 }
 
+void LogManager::set_shipping_options(const shipping_options& opts) {
+    shipping_opts_ = opts;
+}
+
+const LogManager::shipping_options& LogManager::get_shipping_options() const {
+    return shipping_opts_;
+}
+
+LogManager::shipping_stats LogManager::get_shipping_stats() const {
+    return {flushed_records_.load(std::memory_order_relaxed),
+            dropped_records_.load(std::memory_order_relaxed),
+            batches_.load(std::memory_order_relaxed)};
+}
+
 void LogManager::init_logging() {
     sdk_logger_.channel(global_resource_name());
 
@@ -3,6 +3,9 @@
 /// @brief Defines logging infrastructure
 #pragma once
 
+#include <atomic>
+#include <chrono>
+#include <cstddef>
 #include <cstdint>
 
 #include <map>
@@ -21,6 +24,10 @@
 namespace viam {
 namespace sdk {
 
+namespace impl {
+struct LogBackend;
+}  // namespace impl
+
 /// @defgroup Log Classes related to logging
 
 /// @brief Severity levels for the logger.
@@ -72,6 +79,45 @@ class LogManager {
         bool operator()(const boost::log::attribute_value_set&) const;
     };
 
+    /// @brief Options controlling how log records are shipped to viam-server when running as a
+    /// module.
+    ///
+    /// Log records are placed on a bounded queue by the thread which emitted them, and a
+    /// background flusher packs them into batched `Log` RPCs. A batch is sent as soon as it reaches
+    /// `max_batch_entries` records or `max_batch_bytes` bytes, or once `flush_interval` has elapsed
+    /// since the last flush, whichever comes first.
+    /// @remark These options are read when the module connects to viam-server, so they must be
+    /// set before the module is started to take effect.
+    struct shipping_options {
+        /// @enum overflow_policy
+        /// @brief What to do with a new log record when the shipping queue is full.
+        enum class overflow_policy : std::uint8_t {
+            /// Block the logging thread until the flusher makes room in the queue.
+            k_block,
+            /// Discard the oldest queued record to make room for the new one.
+            k_drop_oldest,
+        };
+
+        std::size_t queue_capacity = 4096;
+        std::size_t max_batch_entries = 256;
+        std::size_t max_batch_bytes = 1 << 20;
+        std::chrono::milliseconds flush_interval{100};
+        overflow_policy overflow = overflow_policy::k_block;
+    };
+
+    /// @brief Cumulative counters describing log shipping to viam-server.
+    struct shipping_stats {
+        /// @brief Number of log records successfully delivered to viam-server.
+        std::uint64_t flushed_records;
+
+        /// @brief Number of log records discarded, either by the overflow policy or because a
+        /// batch could not be delivered.
+        std::uint64_t dropped_records;
+
+        /// @brief Number of `Log` RPCs issued.
+        std::uint64_t batches;
+    };
+
     /// @brief Returns the unique logger instance.
     ///
     /// This is the only way to access the logger.
@@ -119,9 +165,19 @@ class LogManager {
     /// Users should prefer to log messages using the logging macros below.
     LogSource& module_logger();
 
+    /// @brief Set the options used to ship logs to viam-server when running as a module.
+    void set_shipping_options(const shipping_options& opts);
+
+    /// @brief Return the options used to ship logs to viam-server when running as a module.
+    const shipping_options& get_shipping_options() const;
+
+    /// @brief Return a snapshot of the log shipping counters.
+    shipping_stats get_shipping_stats() const;
+
    private:
     friend class RobotClient;
     friend class Instance;
+    friend struct impl::LogBackend;
     LogManager() = default;
 
     LogManager(const LogManager&) = delete;
@@ -145,6 +201,12 @@ class LogManager {
     log_level module_level_{log_level::info};
 
     std::map<std::string, log_level> resource_levels_;
+
+    shipping_options shipping_opts_;
+
+    std::atomic<std::uint64_t> flushed_records_{0};
+    std::atomic<std::uint64_t> dropped_records_{0};
+    std::atomic<std::uint64_t> batches_{0};
 };
 
 namespace log_detail {
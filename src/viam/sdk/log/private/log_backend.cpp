@@ -3,6 +3,9 @@
 #include <boost/date_time/posix_time/conversion.hpp>
 #include <boost/smart_ptr/make_shared.hpp>
 
+#include <viam/api/common/v1/common.pb.h>
+#include <viam/api/robot/v1/robot.pb.h>
+
 namespace viam {
 namespace sdk {
 namespace impl {
@@ -19,20 +22,181 @@ time_pt ptime_convert(const boost::posix_time::ptime& from) {
     return t + std::chrono::nanoseconds(nsec);
 }
 
-void LogBackend::consume(const boost::log::record_view& rec) const {
-    parent->log(*rec[attr_channel_type{}],
-                to_string(*rec[attr_sev_type{}]),
-                std::string(*rec[boost::log::expressions::smessage]),
-                ptime_convert(*rec[attr_time_type{}]),
-                std::string(*rec[attr_file_type{}]),
-                *rec[attr_line_type{}]);
+LogBackend::LogBackend(send_fn send, const LogManager::shipping_options& opts)
+    : send_fn_(std::move(send)),
+      opts_(opts),
+      mgr_(LogManager::get()),
+      queue_(opts_.queue_capacity),
+      flusher_(&LogBackend::run_, this) {}
+
+LogBackend::~LogBackend() {
+    stop();
+
+    // Anything left over was enqueued by a producer that raced with `stop`.
+    common::v1::LogEntry* entry = nullptr;
+    while (queue_.pop(entry)) {
+        delete entry;
+        mgr_.dropped_records_.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+void LogBackend::consume(const boost::log::record_view& rec) {
+    auto entry = std::make_unique<common::v1::LogEntry>();
+
+    *entry->mutable_logger_name() = *rec[attr_channel_type{}];
+    entry->set_level(to_string(*rec[attr_sev_type{}]));
+    *entry->mutable_message() = std::string(*rec[boost::log::expressions::smessage]);
+    *entry->mutable_time() = to_proto(ptime_convert(*rec[attr_time_type{}]));
+
+    auto& fields = *entry->mutable_caller()->mutable_fields();
+    fields["Defined"].set_bool_value(true);
+    fields["File"].set_string_value(std::string(*rec[attr_file_type{}]));
+    fields["Line"].set_number_value(*rec[attr_line_type{}]);
+
+    enqueue_(std::move(entry));
+}
+
+void LogBackend::flush() {
+    std::unique_lock<std::mutex> lock(lock_);
+
+    // A drain which is already underway may have missed records pushed just before this call, so
+    // wait for one full drain cycle to begin and end after we got here.
+    const auto target = drain_generation_ + 2;
+    while (!stopping_ && drain_generation_ < target) {
+        flush_requested_ = true;
+        wake_cv_.notify_one();
+        drained_cv_.wait(lock);
+    }
+}
+
+void LogBackend::stop() {
+    {
+        const std::lock_guard<std::mutex> lock(lock_);
+        if (stopping_) {
+            return;
+        }
+        stopping_ = true;
+    }
+
+    stopped_.store(true, std::memory_order_release);
+    wake_cv_.notify_one();
+    room_cv_.notify_all();
+
+    if (flusher_.joinable()) {
+        flusher_.join();
+    }
 }
 
 boost::shared_ptr<SinkType> LogBackend::create(RobotClient* p) {
-    auto backend = boost::make_shared<LogBackend>(p);
+    auto backend = boost::make_shared<LogBackend>(
+        [p](robot::v1::LogRequest& req) { return p->send_logs(req); },
+        LogManager::get().get_shipping_options());
     return boost::make_shared<SinkType>(backend);
 }
 
+void LogBackend::enqueue_(std::unique_ptr<common::v1::LogEntry> entry) {
+    while (!queue_.bounded_push(entry.get())) {
+        if (stopped_.load(std::memory_order_acquire)) {
+            mgr_.dropped_records_.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+
+        if (opts_.overflow == LogManager::shipping_options::overflow_policy::k_drop_oldest) {
+            common::v1::LogEntry* oldest = nullptr;
+            if (queue_.pop(oldest)) {
+                queued_.fetch_sub(1, std::memory_order_relaxed);
+                delete oldest;
+                mgr_.dropped_records_.fetch_add(1, std::memory_order_relaxed);
+            }
+            continue;
+        }
+
+        // The queue is full and we were asked not to lose records: prod the flusher and wait for
+        // it to make room. The timeout guards against a missed notification, since the flusher
+        // signals without taking the lock.
+        wake_cv_.notify_one();
+        std::unique_lock<std::mutex> lock(lock_);
+        room_cv_.wait_for(lock, std::chrono::milliseconds(10));
+    }
+
+    entry.release();
+
+    // Only wake the flusher early once there is a full batch waiting; otherwise it will pick the
+    // records up when the flush interval elapses.
+    const auto queued = queued_.fetch_add(1, std::memory_order_relaxed) + 1;
+    if (queued == static_cast<std::ptrdiff_t>(opts_.max_batch_entries)) {
+        wake_cv_.notify_one();
+    }
+}
+
+void LogBackend::run_() {
+    std::unique_lock<std::mutex> lock(lock_);
+    while (true) {
+        wake_cv_.wait_for(lock, opts_.flush_interval, [this] {
+            return stopping_ || flush_requested_ ||
+                   queued_.load(std::memory_order_relaxed) >=
+                       static_cast<std::ptrdiff_t>(opts_.max_batch_entries);
+        });
+
+        const bool stopping = stopping_;
+        flush_requested_ = false;
+
+        lock.unlock();
+        drain_();
+        lock.lock();
+
+        ++drain_generation_;
+        drained_cv_.notify_all();
+
+        if (stopping) {
+            return;
+        }
+    }
+}
+
+void LogBackend::drain_() {
+    robot::v1::LogRequest req;
+    std::size_t batch_bytes = 0;
+
+    common::v1::LogEntry* entry = nullptr;
+    while (queue_.pop(entry)) {
+        queued_.fetch_sub(1, std::memory_order_relaxed);
+        std::unique_ptr<common::v1::LogEntry> owned(entry);
+
+        const std::size_t entry_bytes = owned->ByteSizeLong();
+        if (req.logs_size() > 0 && batch_bytes + entry_bytes > opts_.max_batch_bytes) {
+            send_(req);
+            batch_bytes = 0;
+        }
+
+        req.mutable_logs()->AddAllocated(owned.release());
+        batch_bytes += entry_bytes;
+
+        if (static_cast<std::size_t>(req.logs_size()) >= opts_.max_batch_entries) {
+            send_(req);
+            batch_bytes = 0;
+        }
+    }
+
+    if (req.logs_size() > 0) {
+        send_(req);
+    }
+}
+
+void LogBackend::send_(robot::v1::LogRequest& req) {
+    const auto count = static_cast<std::uint64_t>(req.logs_size());
+
+    mgr_.batches_.fetch_add(1, std::memory_order_relaxed);
+    if (send_fn_(req)) {
+        mgr_.flushed_records_.fetch_add(count, std::memory_order_relaxed);
+    } else {
+        mgr_.dropped_records_.fetch_add(count, std::memory_order_relaxed);
+    }
+
+    req.mutable_logs()->Clear();
+    room_cv_.notify_all();
+}
+
 }  // namespace impl
 }  // namespace sdk
 }  // namespace viam
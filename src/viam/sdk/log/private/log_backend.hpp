@@ -1,28 +1,103 @@
 #pragma once
 
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#include <boost/lockfree/queue.hpp>
 #include <boost/log/core/record_view.hpp>
 #include <boost/log/sinks/basic_sink_backend.hpp>
-#include <boost/log/sinks/sync_frontend.hpp>
+#include <boost/log/sinks/frontend_requirements.hpp>
+#include <boost/log/sinks/unlocked_frontend.hpp>
 
+#include <viam/sdk/log/logging.hpp>
 #include <viam/sdk/robot/client.hpp>
 
 namespace viam {
+
+namespace common {
+namespace v1 {
+
+class LogEntry;
+
+}  // namespace v1
+}  // namespace common
+
+namespace robot {
+namespace v1 {
+
+class LogRequest;
+
+}  // namespace v1
+}  // namespace robot
+
 namespace sdk {
 namespace impl {
 
 struct LogBackend;
 
-using SinkType = boost::log::sinks::synchronous_sink<LogBackend>;
+// The backend does its own synchronization, so it is safe to feed it without a frontend lock.
+using SinkType = boost::log::sinks::unlocked_sink<LogBackend>;
 
 // Log backend which implements sending messages to RDK.
-struct LogBackend : boost::log::sinks::basic_sink_backend<boost::log::sinks::synchronized_feeding> {
-    LogBackend(RobotClient* p) : parent(p) {}
+//
+// Records are converted to `LogEntry` messages on the thread which emitted them and pushed onto a
+// bounded lock-free queue. A background flusher thread drains the queue and packs the entries into
+// batched `LogRequest`s according to the LogManager::shipping_options in effect when the backend
+// was created.
+struct LogBackend
+    : boost::log::sinks::basic_sink_backend<
+          boost::log::sinks::combine_requirements<boost::log::sinks::concurrent_feeding,
+                                                  boost::log::sinks::flushing>::type> {
+    // Delivers a batch to viam-server, returning true on success.
+    using send_fn = std::function<bool(robot::v1::LogRequest&)>;
+
+    LogBackend(send_fn send, const LogManager::shipping_options& opts);
 
-    void consume(const boost::log::record_view&) const;
+    ~LogBackend();
+
+    void consume(const boost::log::record_view&);
+
+    // Blocks until every record queued before the call has been shipped or dropped.
+    void flush();
+
+    // Ships any queued records and stops the flusher thread. Records consumed afterwards are
+    // counted as dropped.
+    void stop();
 
     static boost::shared_ptr<SinkType> create(RobotClient* p);
 
-    RobotClient* parent;
+   private:
+    void enqueue_(std::unique_ptr<common::v1::LogEntry> entry);
+    void run_();
+    void drain_();
+    void send_(robot::v1::LogRequest& req);
+
+    send_fn send_fn_;
+    LogManager::shipping_options opts_;
+    LogManager& mgr_;
+
+    boost::lockfree::queue<common::v1::LogEntry*> queue_;
+
+    // Approximate number of entries in `queue_`. This is signed because a concurrent pop may be
+    // observed before the matching push is counted.
+    std::atomic<std::ptrdiff_t> queued_{0};
+
+    std::atomic<bool> stopped_{false};
+
+    std::mutex lock_;
+    std::condition_variable wake_cv_;
+    std::condition_variable room_cv_;
+    std::condition_variable drained_cv_;
+    bool stopping_{false};
+    bool flush_requested_{false};
+    unsigned long long drain_generation_{0};
+
+    std::thread flusher_;
 };
 
 // TBD if we want to expose this to users, but for now it is an implementation detail.
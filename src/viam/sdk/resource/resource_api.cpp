@@ -1,10 +1,14 @@
 #include <viam/sdk/resource/resource_api.hpp>
 
+#include <cstdint>
+#include <mutex>
 #include <numeric>
 #include <regex>
+#include <shared_mutex>
 #include <sstream>
 #include <stdexcept>
 #include <string>
+#include <unordered_set>
 
 #include <boost/algorithm/string.hpp>
 #include <google/protobuf/descriptor.h>
@@ -27,23 +31,76 @@ const std::regex MODEL_REGEX("^([\\w-]+):([\\w-]+):([\\w-]+)$");
 // NOLINTNEXTLINE
 std::regex SINGLE_FIELD_REGEX("^([\\w-]+)$");
 
+namespace {
+
+// Returns the canonical copy of `str`, which lives for the rest of the process.
+const std::string* intern(std::string str) {
+    static const std::string empty;
+    if (str.empty()) {
+        return &empty;
+    }
+
+    // Deliberately leaked, so that interned strings outlive any static `API` referring to them.
+    // The pool only grows: nothing is ever removed, so a pointer into it stays valid, and it is
+    // bounded by the number of distinct namespaces, types and subtypes the process has seen.
+    static auto* const lock = new std::shared_timed_mutex;          // NOLINT
+    static auto* const pool = new std::unordered_set<std::string>;  // NOLINT
+
+    // Nearly every string is already interned, so readers only share the lock.
+    {
+        const std::shared_lock<std::shared_timed_mutex> guard(*lock);
+        const auto where = pool->find(str);
+        if (where != pool->end()) {
+            return &*where;
+        }
+    }
+
+    const std::lock_guard<std::shared_timed_mutex> guard(*lock);
+    return &*pool->insert(std::move(str)).first;
+}
+
+// FNV-1a, which lets us hash the pieces of a string representation without concatenating them.
+constexpr std::size_t k_hash_basis = static_cast<std::size_t>(14695981039346656037ULL);
+constexpr std::size_t k_hash_prime = static_cast<std::size_t>(1099511628211ULL);
+
+std::size_t hash_append(std::size_t hash, char c) {
+    return (hash ^ static_cast<unsigned char>(c)) * k_hash_prime;
+}
+
+std::size_t hash_append(std::size_t hash, const std::string& str) {
+    for (const char c : str) {
+        hash = hash_append(hash, c);
+    }
+    return hash;
+}
+
+// `Name::to_string` treats a remote name of ":" the same as no remote name at all.
+const std::string& effective_remote_name(const std::string& remote_name) {
+    static const std::string none;
+    return remote_name == ":" ? none : remote_name;
+}
+
+}  // namespace
+
+API::API() : API({}, {}, {}) {}
+
 std::string API::to_string() const {
     std::ostringstream os;
-    os << namespace_ << ":" << resource_type_ << ":" << resource_subtype_;
+    os << *namespace_ << ":" << *resource_type_ << ":" << *resource_subtype_;
 
     return os.str();
 }
 
 const std::string& API::type_namespace() const {
-    return namespace_;
+    return *namespace_;
 }
 
 const std::string& API::resource_type() const {
-    return resource_type_;
+    return *resource_type_;
 }
 
 const std::string& API::resource_subtype() const {
-    return resource_subtype_;
+    return *resource_subtype_;
 }
 
 API API::from_string(std::string api) {
@@ -56,20 +113,38 @@ API API::from_string(std::string api) {
 }
 
 API::API(std::string ns, std::string resource_type, std::string resource_subtype)
-    : namespace_(std::move(ns)),
-      resource_type_(std::move(resource_type)),
-      resource_subtype_(std::move(resource_subtype)) {}
+    : namespace_(intern(std::move(ns))),
+      resource_type_(intern(std::move(resource_type))),
+      resource_subtype_(intern(std::move(resource_subtype))) {
+    // Equivalent to hashing `to_string()`.
+    hash_ = hash_append(k_hash_basis, *namespace_);
+    hash_ = hash_append(hash_, ':');
+    hash_ = hash_append(hash_, *resource_type_);
+    hash_ = hash_append(hash_, ':');
+    hash_ = hash_append(hash_, *resource_subtype_);
+}
 
 bool API::is_service_type() {
-    return resource_type_ == "service";
+    return *resource_type_ == "service";
 }
 
 bool API::is_component_type() {
-    return resource_type_ == "component";
+    return *resource_type_ == "component";
 }
 
+Name::Name() : Name({}, {}, {}) {}
+
 Name::Name(API api, std::string remote, std::string name)
-    : api_(std::move(api)), remote_name_(std::move(remote)), name_(std::move(name)) {}
+    : api_(std::move(api)), remote_name_(std::move(remote)), name_(std::move(name)) {
+    // Continues the hash of the API as though hashing `to_string()`.
+    hash_ = hash_append(api_.hash(), '/');
+    const std::string& remote_name = effective_remote_name(remote_name_);
+    if (!remote_name.empty()) {
+        hash_ = hash_append(hash_, remote_name);
+        hash_ = hash_append(hash_, ':');
+    }
+    hash_ = hash_append(hash_, name_);
+}
 
 const API& Name::api() const {
     return api_;
@@ -143,13 +218,14 @@ Name from_proto_impl<common::v1::ResourceName>::operator()(
 }  // namespace proto_convert_details
 
 bool operator==(const API& lhs, const API& rhs) {
+    // Components are interned, so equal strings have equal addresses.
     return std::tie(lhs.namespace_, lhs.resource_type_, lhs.resource_subtype_) ==
            std::tie(rhs.namespace_, rhs.resource_type_, rhs.resource_subtype_);
 }
 
 bool operator<(const API& lhs, const API& rhs) {
-    return std::tie(lhs.namespace_, lhs.resource_type_, lhs.resource_subtype_) <
-           std::tie(rhs.namespace_, rhs.resource_type_, rhs.resource_subtype_);
+    return std::tie(*lhs.namespace_, *lhs.resource_type_, *lhs.resource_subtype_) <
+           std::tie(*rhs.namespace_, *rhs.resource_type_, *rhs.resource_subtype_);
 }
 
 std::ostream& operator<<(std::ostream& os, const API& v) {
@@ -158,7 +234,8 @@ std::ostream& operator<<(std::ostream& os, const API& v) {
 }
 
 bool operator==(const Name& lhs, const Name& rhs) {
-    return lhs.to_string() == rhs.to_string();
+    return lhs.hash_ == rhs.hash_ && lhs.api_ == rhs.api_ && lhs.name_ == rhs.name_ &&
+           effective_remote_name(lhs.remote_name_) == effective_remote_name(rhs.remote_name_);
 }
 
 std::ostream& operator<<(std::ostream& os, const Name& v) {
@@ -167,8 +244,8 @@ std::ostream& operator<<(std::ostream& os, const Name& v) {
 }
 
 bool operator==(const RPCSubtype& lhs, const RPCSubtype& rhs) {
-    return std::tie(lhs.api(), lhs.proto_service_name()) ==
-           std::tie(rhs.api(), rhs.proto_service_name());
+    return lhs.hash_ == rhs.hash_ && std::tie(lhs.api(), lhs.proto_service_name()) ==
+                                         std::tie(rhs.api(), rhs.proto_service_name());
 }
 
 bool operator==(const Model& lhs, const Model& rhs) {
@@ -176,9 +253,11 @@ bool operator==(const Model& lhs, const Model& rhs) {
 }
 
 RPCSubtype::RPCSubtype(API api, std::string proto_service_name)
-    : api_(std::move(api)), proto_service_name_(std::move(proto_service_name)) {}
+    : api_(std::move(api)),
+      proto_service_name_(std::move(proto_service_name)),
+      hash_(hash_append(api_.hash(), proto_service_name_)) {}
 
-RPCSubtype::RPCSubtype(API api) : api_(std::move(api)) {}
+RPCSubtype::RPCSubtype(API api) : RPCSubtype(std::move(api), {}) {}
 
 const std::string& RPCSubtype::proto_service_name() const {
     return proto_service_name_;
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstddef>
 #include <string>
 
 #include <viam/sdk/common/proto_convert.hpp>
@@ -18,14 +19,15 @@ namespace viam {
 namespace sdk {
 
 /// @class API
+///
+/// The components of an `API` are interned, since there are few distinct values and they are
+/// compared and hashed frequently; copying an `API` does not copy any strings. The hash is
+/// computed once, at construction.
 class API {
    public:
-    // Choosing to make this a friend rather than exposing public setters for everyone.
-    friend class ResourceConfig;
-
     static API from_string(std::string api);
 
-    API() = default;
+    API();
     API(std::string ns, std::string resource_type, std::string resource_subtype);
 
     std::string to_string() const;
@@ -37,6 +39,11 @@ class API {
     bool is_component_type();
     bool is_service_type();
 
+    /// @brief Returns the precomputed hash of this API.
+    std::size_t hash() const noexcept {
+        return hash_;
+    }
+
     friend bool operator==(API const& lhs, API const& rhs);
     friend bool operator<(const API& lhs, const API& rhs);
 
@@ -51,19 +58,24 @@ class API {
     }
 
    private:
-    std::string namespace_;
-    std::string resource_type_;
-    std::string resource_subtype_;
+    // Interned, so never null, and equal components are at equal addresses.
+    const std::string* namespace_;
+    const std::string* resource_type_;
+    const std::string* resource_subtype_;
+    std::size_t hash_;
 };
 
 /// @class Name
 /// @brief A name for specific instances of resources.
+///
+/// Two names are equal when their `to_string` representations are equal, but neither comparison
+/// nor hashing builds that string: the hash is computed once, at construction.
 class Name {
    public:
     static Name from_string(std::string name);
 
     Name(API api, std::string remote_name, std::string name);
-    Name() = default;
+    Name();
 
     std::string short_name() const;
     std::string to_string() const;
@@ -72,6 +84,11 @@ class Name {
     const std::string& name() const;
     const std::string& remote_name() const;
 
+    /// @brief Returns the precomputed hash of this name.
+    std::size_t hash() const noexcept {
+        return hash_;
+    }
+
     friend bool operator==(const Name& lhs, const Name& rhs);
     friend std::ostream& operator<<(std::ostream& os, const Name& v);
 
@@ -79,6 +96,7 @@ class Name {
     API api_;
     std::string remote_name_;
     std::string name_;
+    std::size_t hash_;
 };
 
 namespace proto_convert_details {
@@ -103,11 +121,17 @@ class RPCSubtype {
     const API& api() const;
     const std::string& proto_service_name() const;
 
+    /// @brief Returns the precomputed hash of this subtype.
+    std::size_t hash() const noexcept {
+        return hash_;
+    }
+
     friend bool operator==(const RPCSubtype& lhs, const RPCSubtype& rhs);
 
    private:
     API api_;
     std::string proto_service_name_;
+    std::size_t hash_;
 };
 
 class ModelFamily {
@@ -155,22 +179,20 @@ class Model {
 template <>
 struct std::hash<::viam::sdk::Name> {
     size_t operator()(::viam::sdk::Name const& key) const noexcept {
-        return std::hash<std::string>()(key.to_string());
+        return key.hash();
     }
 };
 
 template <>
 struct std::hash<::viam::sdk::RPCSubtype> {
     size_t operator()(::viam::sdk::RPCSubtype const& key) const noexcept {
-        const ::viam::sdk::API& api = key.api();
-        std::string hash = api.to_string() + key.proto_service_name();
-        return std::hash<std::string>()(hash);
+        return key.hash();
     };
 };
 
 template <>
 struct std::hash<::viam::sdk::API> {
     size_t operator()(const ::viam::sdk::API& key) const noexcept {
-        return std::hash<std::string>()(key.to_string());
+        return key.hash();
     };
 };
@@ -3,6 +3,7 @@
 #include <exception>
 #include <memory>
 #include <string>
+#include <thread>
 #include <unordered_map>
 #include <vector>
 
@@ -21,18 +22,60 @@
 namespace viam {
 namespace sdk {
 
+// Registers a reader of the current snapshot for the lifetime of the guard. The snapshot which the
+// guard observes will not be freed until the guard is destroyed.
+class ResourceManager::read_guard {
+   public:
+    explicit read_guard(ResourceManager& mgr) {
+        // If a publisher advanced the epoch between our reading it and registering, it may not
+        // wait for us, so register again against the new epoch.
+        while (true) {
+            const auto epoch = mgr.epoch_.load();
+            counter_ = &mgr.readers_[epoch & 1];
+            counter_->fetch_add(1);
+            if (mgr.epoch_.load() == epoch) {
+                break;
+            }
+            counter_->fetch_sub(1);
+        }
+
+        snapshot_ = mgr.snapshot_.load();
+    }
+
+    ~read_guard() {
+        counter_->fetch_sub(1);
+    }
+
+    read_guard(const read_guard&) = delete;
+    read_guard& operator=(const read_guard&) = delete;
+
+    const snapshot* operator->() const {
+        return snapshot_;
+    }
+
+   private:
+    std::atomic<std::uint64_t>* counter_;
+    const snapshot* snapshot_;
+};
+
+ResourceManager::ResourceManager() : snapshot_(new snapshot()) {}
+
+ResourceManager::~ResourceManager() {
+    delete snapshot_.load();
+}
+
 std::shared_ptr<Resource> ResourceManager::resource(const std::string& name) {
-    const std::lock_guard<std::mutex> lock(lock_);
+    const read_guard snap(*this);
 
-    auto res_it = resources_.find(name);
-    if (res_it != resources_.end()) {
+    auto res_it = snap->resources.find(name);
+    if (res_it != snap->resources.end()) {
         return res_it->second;
     }
 
-    auto name_it = short_names_.find(name);
-    if (name_it != short_names_.end()) {
-        res_it = resources_.find(name_it->second);
-        if (res_it != resources_.end()) {
+    auto name_it = snap->short_names.find(name);
+    if (name_it != snap->short_names.end()) {
+        res_it = snap->resources.find(name_it->second);
+        if (res_it != snap->resources.end()) {
             return res_it->second;
         }
     }
@@ -40,22 +83,56 @@ std::shared_ptr<Resource> ResourceManager::resource(const std::string& name) {
     return nullptr;
 }
 
+void ResourceManager::publish(std::unique_ptr<snapshot> next) {
+    const snapshot* prev = snapshot_.exchange(next.release());
+
+    // Any reader which could have observed `prev` is registered under the old epoch's parity.
+    const auto epoch = epoch_.fetch_add(1);
+    while (readers_[epoch & 1].load() != 0) {
+        std::this_thread::yield();
+    }
+
+    delete prev;
+}
+
 void ResourceManager::replace_all(
     const std::unordered_map<Name, std::shared_ptr<Resource>>& resources) {
     const std::lock_guard<std::mutex> lock(lock_);
-    const std::unordered_map<std::string, std::shared_ptr<Resource>> new_resources;
-    const std::unordered_map<std::string, std::string> new_short_names;
-    this->resources_ = new_resources;
-    this->short_names_ = new_short_names;
+    auto next = std::make_unique<snapshot>();
 
     for (const auto& resource : resources) {
         try {
-            do_add(resource.first, resource.second);
+            do_add(*next, resource.first, resource.second);
         } catch (std::exception& exc) {
             VIAM_SDK_LOG(error) << "Error replacing all resources" << exc.what();
-            return;
+            break;
         }
     }
+
+    publish(std::move(next));
+}
+
+void ResourceManager::update(const std::vector<Name>& removed,
+                             const std::unordered_map<Name, std::shared_ptr<Resource>>& added) {
+    const std::lock_guard<std::mutex> lock(lock_);
+    auto next = std::make_unique<snapshot>(*snapshot_.load());
+
+    for (const Name& name : removed) {
+        if (next->resources.find(name.short_name()) != next->resources.end()) {
+            do_remove(*next, name);
+        }
+    }
+
+    for (const auto& resource : added) {
+        try {
+            do_add(*next, resource.first, resource.second);
+        } catch (std::exception& exc) {
+            VIAM_SDK_LOG(error) << "Error adding resource " << resource.first.to_string() << ": "
+                                << exc.what();
+        }
+    }
+
+    publish(std::move(next));
 }
 
 std::string get_shortcut_name(const std::string& name) {
@@ -66,65 +143,71 @@ std::string get_shortcut_name(const std::string& name) {
     return name_split.at(name_split.size() - 1);
 }
 
-void ResourceManager::do_add(const Name& name, std::shared_ptr<Resource> resource) {
+void ResourceManager::do_add(snapshot& snap,
+                             const Name& name,
+                             std::shared_ptr<Resource> resource) {
     if (name.name().empty()) {
         throw Exception("Empty name used for resource: " + name.to_string());
     }
     std::string short_name = name.short_name();
 
-    do_add(std::move(short_name), std::move(resource));
+    do_add(snap, std::move(short_name), std::move(resource));
 }
 
-void ResourceManager::do_add(std::string name, std::shared_ptr<Resource> resource) {
-    if (resources_.find(name) != resources_.end()) {
+void ResourceManager::do_add(snapshot& snap,
+                             std::string name,
+                             std::shared_ptr<Resource> resource) {
+    if (snap.resources.find(name) != snap.resources.end()) {
         throw Exception(ErrorCondition::k_duplicate_resource,
                         "Attempted to add resource that already existed: " + name);
     }
 
     std::string shortcut = get_shortcut_name(name);
     if (shortcut != name) {
-        if (short_names_.find(shortcut) != short_names_.end()) {
-            short_names_.emplace(std::move(shortcut), "");
+        if (snap.short_names.find(shortcut) != snap.short_names.end()) {
+            snap.short_names.emplace(std::move(shortcut), "");
         } else {
-            short_names_.emplace(std::move(shortcut), name);
+            snap.short_names.emplace(std::move(shortcut), name);
         }
     }
-    resources_.emplace(std::move(name), std::move(resource));
+    snap.resources.emplace(std::move(name), std::move(resource));
 }
 
 void ResourceManager::add(const Name& name, std::shared_ptr<Resource> resource) {
     const std::lock_guard<std::mutex> lock(lock_);
     try {
-        do_add(name, std::move(resource));
+        auto next = std::make_unique<snapshot>(*snapshot_.load());
+        do_add(*next, name, std::move(resource));
+        publish(std::move(next));
     } catch (std::exception& exc) {
         VIAM_SDK_LOG(error) << "Error adding resource to subtype service: " << exc.what();
     }
 };
 
-void ResourceManager::do_remove(const Name& name) {
+void ResourceManager::do_remove(snapshot& snap, const Name& name) {
     const std::string short_name = name.short_name();
-    if (resources_.find(short_name) == resources_.end()) {
+    if (snap.resources.find(short_name) == snap.resources.end()) {
         throw Exception(
             ErrorCondition::k_resource_not_found,
             "Attempted to remove resource " + name.to_string() + " but it didn't exist!");
     }
 
-    resources_.erase(short_name);
+    snap.resources.erase(short_name);
 
     std::string const shortcut = get_shortcut_name(short_name);
-    if (short_names_.find(shortcut) != short_names_.end()) {
-        short_names_.erase(shortcut);
+    if (snap.short_names.find(shortcut) != snap.short_names.end()) {
+        snap.short_names.erase(shortcut);
     }
 
     // case: remote1:nameA and remote2:nameA both existed, and remote2:nameA is
     // being deleted, restore shortcut to remote1:nameA
-    for (auto& res : resources_) {
+    for (auto& res : snap.resources) {
         const std::string key = res.first;
         if (shortcut == get_shortcut_name(key) && short_name != get_shortcut_name(key)) {
-            if (short_names_.find(shortcut) != short_names_.end()) {
-                short_names_.emplace(shortcut, "");
+            if (snap.short_names.find(shortcut) != snap.short_names.end()) {
+                snap.short_names.emplace(shortcut, "");
             } else {
-                short_names_.emplace(shortcut, key);
+                snap.short_names.emplace(shortcut, key);
             }
         }
     }
@@ -133,7 +216,9 @@ void ResourceManager::do_remove(const Name& name) {
 void ResourceManager::remove(const Name& name) {
     const std::lock_guard<std::mutex> lock(lock_);
     try {
-        do_remove(name);
+        auto next = std::make_unique<snapshot>(*snapshot_.load());
+        do_remove(*next, name);
+        publish(std::move(next));
     } catch (std::exception& exc) {
         VIAM_SDK_LOG(error) << "unable to remove resource: " << exc.what();
     }
@@ -142,24 +227,29 @@ void ResourceManager::remove(const Name& name) {
 void ResourceManager::replace_one(
     const Name& name, const std::function<std::shared_ptr<Resource>()>& create_resource) {
     const std::lock_guard<std::mutex> lock(lock_);
+    auto next = std::make_unique<snapshot>(*snapshot_.load());
     try {
-        do_remove(name);
-        do_add(name, create_resource());
+        do_remove(*next, name);
+        do_add(*next, name, create_resource());
     } catch (std::exception& exc) {
         VIAM_SDK_LOG(error) << "failed to replace resource " << name.to_string() << ": "
                             << exc.what();
     }
+
+    publish(std::move(next));
 }
 
 const std::unordered_map<std::string, std::shared_ptr<Resource>>& ResourceManager::resources()
     const {
-    return resources_;
+    return snapshot_.load()->resources;
 }
 
 void ResourceManager::add(std::string name, std::shared_ptr<Resource> resource) {
     const std::lock_guard<std::mutex> lock(lock_);
+    auto next = std::make_unique<snapshot>(*snapshot_.load());
     // NOLINTNEXTLINE(clang-analyzer-cplusplus.NewDeleteLeaks)
-    do_add(std::move(name), std::move(resource));
+    do_add(*next, std::move(name), std::move(resource));
+    publish(std::move(next));
 }
 
 }  // namespace sdk
@@ -3,11 +3,16 @@
 /// @brief Defines a general-purpose resource manager.
 #pragma once
 
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <functional>
 #include <memory>
 #include <mutex>
 #include <string>
 #include <type_traits>
 #include <unordered_map>
+#include <vector>
 
 #include <boost/optional/optional.hpp>
 
@@ -19,9 +24,13 @@ namespace sdk {
 
 /// @class ResourceManager
 /// @brief Defines a resource manager for use by anything that tracks resources.
+///
+/// Lookups run against an immutable snapshot of the managed resources, so they never block on each
+/// other or on modifications. Modifications are serialized, and each one publishes a new snapshot.
 class ResourceManager {
    public:
-    ResourceManager() = default;
+    ResourceManager();
+    ~ResourceManager();
 
     /// @brief Returns a resource.
     /// @param name the name of the desired resource.
@@ -41,6 +50,13 @@ class ResourceManager {
     /// @param resources The resources to replace with.
     void replace_all(const std::unordered_map<Name, std::shared_ptr<Resource>>& resources);
 
+    /// @brief Removes and adds resources in a single modification, leaving all others in place.
+    /// @param removed The names of the resources to remove. Names which are not present are
+    /// ignored.
+    /// @param added The resources to add.
+    void update(const std::vector<Name>& removed,
+                const std::unordered_map<Name, std::shared_ptr<Resource>>& added);
+
     /// @brief Adds a single resource to the manager.
     /// @param name The name of the resource.
     /// @param resource The resource being added.
@@ -63,16 +79,35 @@ class ResourceManager {
                      const std::function<std::shared_ptr<Resource>()>& create_resource);
 
     /// @brief Returns a reference to the existing resources within the manager.
+    /// @remark The reference is only valid until the manager is next modified.
     const std::unordered_map<std::string, std::shared_ptr<Resource>>& resources() const;
 
    private:
+    struct snapshot {
+        std::unordered_map<std::string, std::shared_ptr<Resource>> resources;
+        /// @brief `short_names` is a shortened version of `Name` N of form <remote>:<name>.
+        std::unordered_map<std::string, std::string> short_names;
+    };
+
+    class read_guard;
+
+    // Swaps in `next` as the current snapshot, then waits for readers of the previous snapshot to
+    // finish before freeing it. Must be called with `lock_` held.
+    void publish(std::unique_ptr<snapshot> next);
+
+    static void do_add(snapshot& snap, const Name& name, std::shared_ptr<Resource> resource);
+    static void do_add(snapshot& snap, std::string name, std::shared_ptr<Resource> resource);
+    static void do_remove(snapshot& snap, const Name& name);
+
+    // Serializes modifications; lookups never take it.
     std::mutex lock_;
-    std::unordered_map<std::string, std::shared_ptr<Resource>> resources_;
-    /// @brief `short_names_` is a shortened version of `Name` N of form <remote>:<name>.
-    std::unordered_map<std::string, std::string> short_names_;
-    void do_add(const Name& name, std::shared_ptr<Resource> resource);
-    void do_add(std::string name, std::shared_ptr<Resource> resource);
-    void do_remove(const Name& name);
+
+    std::atomic<const snapshot*> snapshot_;
+
+    // Readers register against the counter selected by the parity of `epoch_`. Publishing a
+    // snapshot advances the epoch and then waits for the previous parity's readers to drain.
+    std::atomic<std::uint64_t> epoch_{0};
+    std::array<std::atomic<std::uint64_t>, 2> readers_{};
 };
 
 }  // namespace sdk
@@ -1,12 +1,17 @@
 #include <exception>
 #include <viam/sdk/robot/client.hpp>
 
+#include <atomic>
 #include <chrono>
+#include <condition_variable>
 #include <cstddef>
 #include <memory>
 #include <mutex>
 #include <string>
 #include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
 #include <vector>
 
 #include <boost/log/core/core.hpp>
@@ -24,9 +29,11 @@
 #include <viam/sdk/common/proto_value.hpp>
 #include <viam/sdk/common/utils.hpp>
 #include <viam/sdk/components/component.hpp>
+#include <viam/sdk/components/sensor.hpp>
 #include <viam/sdk/log/private/log_backend.hpp>
 #include <viam/sdk/registry/registry.hpp>
 #include <viam/sdk/resource/resource.hpp>
+#include <viam/sdk/robot/private/connection_watcher.hpp>
 #include <viam/sdk/rpc/dial.hpp>
 #include <viam/sdk/rpc/private/viam_grpc_channel.hpp>
 #include <viam/sdk/services/service.hpp>
@@ -90,8 +97,24 @@ bool operator==(const RobotClient::operation& lhs, const RobotClient::operation&
 }
 
 struct RobotClient::impl {
-    impl(std::unique_ptr<RobotService::Stub> stub, ViamChannel& channel)
-        : stub(std::move(stub)), channel_(&channel) {}
+    // One dial of the robot. The connection watcher replaces it as a whole when it redials. Calls
+    // in flight and the resource clients made on it share ownership of it, so that it outlives
+    // them even once it has been replaced.
+    struct connection {
+        explicit connection(ViamChannel viam_channel)
+            : channel_(std::move(viam_channel)),
+              stub(RobotService::NewStub(channel_.channel())) {}
+
+        const ViamChannel& channel() const {
+            return channel_;
+        }
+
+        ViamChannel channel_;
+        std::unique_ptr<RobotService::Stub> stub;
+    };
+
+    explicit impl(ViamChannel channel)
+        : connection_(std::make_shared<connection>(std::move(channel))) {}
 
     ~impl() {
         if (log_sink) {
@@ -103,19 +126,41 @@ struct RobotClient::impl {
 
     template <typename Method>
     static auto client_helper(const std::unique_ptr<impl>& self, Method m) {
-        if (!self) {
+        if (!self || self->gave_up.load()) {
             throw std::runtime_error(
                 "Tried to call RobotClient method while not connected to robot");
         }
-        return make_client_helper(self.get(), *self->stub, m);
+        auto current = self->current();
+        auto* const client = current.get();
+        return make_client_helper(
+            client, std::shared_ptr<RobotService::Stub>(std::move(current), client->stub.get()), m);
     }
 
-    const ViamChannel& channel() const {
-        return *channel_;
+    std::shared_ptr<connection> current() const {
+        return std::atomic_load(&connection_);
     }
 
-    std::unique_ptr<RobotService::Stub> stub;
-    const ViamChannel* channel_;
+    void replace(std::shared_ptr<connection> next) {
+        std::atomic_store(&connection_, std::move(next));
+    }
+
+    // Makes `resource`, a client created on `conn`, keep `conn` alive for as long as it is used.
+    static std::shared_ptr<Resource> keep_alive(std::shared_ptr<connection> conn,
+                                                std::shared_ptr<Resource> resource) {
+        auto* const raw = resource.get();
+        return std::shared_ptr<Resource>(
+            std::make_shared<std::pair<std::shared_ptr<connection>, std::shared_ptr<Resource>>>(
+                std::move(conn), std::move(resource)),
+            raw);
+    }
+
+    // Only accessed through `current` and `replace`, since the connection watcher replaces it
+    // while other threads are making calls on it.
+    std::shared_ptr<connection> connection_;
+
+    // Set by the connection watcher once it stops trying to reconnect. The client stays in this
+    // state until it is closed.
+    std::atomic<bool> gave_up{false};
 
     // See doc comment for RobotClient::connect_logging. This pointer is non-null and installed as a
     // sink only for apps being run by viam-server as a module.
@@ -141,6 +186,16 @@ void RobotClient::connect_logging() {
     }
 }
 
+void RobotClient::disconnect_logging() {
+    auto& sink = impl_->log_sink;
+    if (sink) {
+        boost::log::core::get()->remove_sink(sink);
+        sink->locked_backend()->stop();
+        sink.reset();
+        LogManager::get().enable_console_logging();
+    }
+}
+
 RobotClient::~RobotClient() {
     try {
         this->close();
@@ -153,19 +208,22 @@ RobotClient::~RobotClient() {
 
 void RobotClient::close() {
     should_refresh_.store(false);
-    should_check_connection_.store(false);
 
-    if (refresh_thread_.joinable()) {
-        refresh_thread_.join();
+    if (connection_watch_ != 0) {
+        sdk::impl::ConnectionWatcher::get().unwatch(connection_watch_);
+        connection_watch_ = 0;
     }
 
-    if (check_connection_thread_.joinable()) {
-        check_connection_thread_.join();
+    if (refresh_thread_.joinable()) {
+        refresh_thread_.join();
     }
 
     stop_all();
 
-    viam_channel_.close();
+    if (impl_) {
+        disconnect_logging();
+        impl_->current()->channel_.close();
+    }
 
     impl_.reset();
 }
@@ -192,42 +250,73 @@ void RobotClient::block_for_operation(std::string id) {
         .invoke();
 }
 
+namespace {
+
+// The name under which refresh registers the client for the resource `name`, or none for remotes,
+// which don't get clients of their own.
+boost::optional<Name> client_name(const Name& name) {
+    if (name.api().resource_subtype() == "remote") {
+        return boost::none;
+    }
+    return Name(name.api(), "", name.name());
+}
+
+}  // namespace
+
 void RobotClient::refresh() {
-    auto resources =
+    auto current_resources =
         impl::client_helper(impl_, &RobotService::Stub::ResourceNames).invoke([](auto& response) {
-            return response.resources();
+            return sdk::impl::from_repeated_field(response.resources());
         });
 
-    std::unordered_map<Name, std::shared_ptr<Resource>> new_resources;
-    std::vector<Name> current_resources;
-    for (const auto& name : resources) {
-        current_resources.push_back(from_proto(name));
-        if (name.subtype() == "remote") {
+    const auto conn = impl_->current();
+    std::unordered_set<Name> removed;
+    {
+        const std::lock_guard<std::mutex> lock(lock_);
+        if (current_resources == resource_names_) {
+            return;
+        }
+        for (const Name& name : resource_names_) {
+            if (auto key = client_name(name)) {
+                removed.insert(std::move(*key));
+            }
+        }
+    }
+
+    // Only resources which are new since the last refresh, or whose client could not be created
+    // before, get a client. Whatever is left in `removed` afterwards is gone from the robot, and
+    // every other client is kept as it is.
+    std::unordered_map<Name, std::shared_ptr<Resource>> added;
+    for (const Name& name : current_resources) {
+        auto key = client_name(name);
+        if (!key || added.count(*key) != 0) {
+            continue;
+        }
+        if (removed.erase(*key) != 0 && resource_manager_.resource(key->short_name())) {
             continue;
         }
 
         const std::shared_ptr<const ResourceClientRegistration> rs =
-            Registry::get().lookup_resource_client(
-                {name.namespace_(), name.type(), name.subtype()});
+            Registry::get().lookup_resource_client(key->api());
         if (rs) {
             try {
-                const std::shared_ptr<Resource> rpc_client =
-                    rs->create_rpc_client(name.name(), viam_channel_);
-                const Name name_({name.namespace_(), name.type(), name.subtype()}, "", name.name());
-                new_resources.emplace(name_, rpc_client);
+                auto client = rs->create_rpc_client(key->name(), conn->channel());
+                added.emplace(*key, impl::keep_alive(conn, std::move(client)));
             } catch (const std::exception& exc) {
-                VIAM_SDK_LOG(debug)
-                    << "Error registering component " << name.subtype() << ": " << exc.what();
+                VIAM_SDK_LOG(debug) << "Error registering component "
+                                    << key->api().resource_subtype() << ": " << exc.what();
             }
         }
     }
-    if (current_resources == resource_names_) {
-        return;
-    }
 
     const std::lock_guard<std::mutex> lock(lock_);
+    if (impl_->current() != conn) {
+        // A reconnect replaced every client while this refresh was running, and refreshes on the
+        // new connection itself.
+        return;
+    }
     resource_names_ = std::move(current_resources);
-    this->resource_manager_.replace_all(new_resources);
+    resource_manager_.update({removed.begin(), removed.end()}, added);
 }
 
 void RobotClient::refresh_every() {
@@ -242,117 +331,106 @@ void RobotClient::refresh_every() {
     }
 };
 
-void RobotClient::check_connection() {
+void RobotClient::watch_connection() {
     auto check_every = check_every_interval_;
-    auto reconnect_every = reconnect_every_interval_;
     if (check_every == std::chrono::seconds{0}) {
-        check_every = reconnect_every;
+        check_every = reconnect_every_interval_;
     }
-    if (check_every == std::chrono::seconds{0} && reconnect_every == std::chrono::seconds{0}) {
-        should_check_connection_.store(false);
+    if (check_every == std::chrono::seconds{0}) {
+        return;
     }
-    bool connected(true);
-    while (should_check_connection_) {
-        std::exception_ptr connection_error;
-        std::string what;
-        for (int i = 0; i < 3; ++i) {
-            try {
-                std::this_thread::sleep_for(check_every);
-                impl::client_helper(impl_, &RobotService::Stub::ResourceNames).invoke([](auto&) {
-                    return;
-                });
-                connected = true;
-                break;
-            } catch (const std::exception& e) {
-                connected = false;
-                connection_error = std::current_exception();
-                what = e.what();
-                std::this_thread::sleep_for(std::chrono::milliseconds{100});
+
+    sdk::impl::ConnectionWatcher::watch_options options;
+    options.name = address_.empty() ? "machine" : "machine at address " + address_;
+    options.keepalive_interval = check_every;
+    options.keepalive = [this, check_every] { return keepalive(check_every); };
+    if (!address_.empty()) {
+        options.reconnect_interval = reconnect_every_interval_;
+        options.reconnect = [this] { return reconnect(); };
+        // Closing the client here would race with its owner, who may be using or closing it on
+        // another thread. Instead, the client is marked disconnected, and is closed by its owner
+        // as usual.
+        options.on_give_up = [this] {
+            should_refresh_.store(false);
+            if (impl_) {
+                impl_->gave_up.store(true);
             }
-        }
-        if (connected) {
-            continue;
-        }
-        const auto* uri = viam_channel_.get_channel_addr();
-        VIAM_SDK_LOG(error) << "Lost connection to machine at address " << uri << " with error "
-                            << what << ". Attempting to reconnect every " << reconnect_every.count()
-                            << "second(s)";
+        };
+    }
 
-        viam_channel_.close();
+    connection_watch_ = sdk::impl::ConnectionWatcher::get().watch(
+        impl_->current()->channel().channel(), std::move(options));
+}
 
-        for (int i = 0; i < 3; ++i) {
-            try {
-                viam_channel_ = ViamChannel::dial(uri, {});
-                impl_ = std::make_unique<RobotClient::impl>(
-                    RobotService::NewStub(viam_channel_.channel()), viam_channel_);
-                refresh();
-                connected = true;
-            } catch (const std::exception& e) {
-                viam_channel_.close();
-                std::this_thread::sleep_for(reconnect_every);
-            }
-        }
-        if (!connected) {
-            close();
-        }
+bool RobotClient::keepalive(std::chrono::seconds timeout) {
+    try {
+        const client_helper_details::CallScope scope(std::chrono::system_clock::now() + timeout,
+                                                     {});
+        impl::client_helper(impl_, &RobotService::Stub::GetVersion).invoke();
+        return true;
+    } catch (const std::exception&) {
+        return false;
     }
 }
 
-RobotClient::RobotClient(ViamChannel channel)
-    : viam_channel_(std::move(channel)),
-      impl_(std::make_unique<impl>(RobotService::NewStub(viam_channel_.channel()), viam_channel_)) {
+std::shared_ptr<GrpcChannel> RobotClient::reconnect() {
+    try {
+        auto next = std::make_shared<impl::connection>(
+            ViamChannel::dial(address_.c_str(), dial_options_));
+
+        // The existing resource clients hold stubs on the old channel, so make new ones for all.
+        // Callers still holding an old client keep the old channel open until they release it.
+        {
+            const std::lock_guard<std::mutex> lock(lock_);
+            impl_->replace(next);
+            resource_names_.clear();
+            resource_manager_.replace_all({});
+        }
+        refresh();
+        return next->channel().channel();
+    } catch (const std::exception& e) {
+        VIAM_SDK_LOG(debug) << "Failed to reconnect to " << address_ << ": " << e.what();
+        return nullptr;
+    }
 }
 
+RobotClient::RobotClient(ViamChannel channel) : impl_(std::make_unique<impl>(std::move(channel))) {}
+
 std::vector<Name> RobotClient::resource_names() const {
     const std::lock_guard<std::mutex> lock(lock_);
     return resource_names_;
 }
 
-void RobotClient::log(const std::string& name,
-                      const std::string& level,
-                      const std::string& message,
-                      time_pt time,
-                      const std::string& file,
-                      unsigned int line) {
+bool RobotClient::send_logs(const robot::v1::LogRequest& req) {
     if (!impl_) {
-        throw std::runtime_error("Tried to send logs to robot when it was not connected");
+        return false;
     }
 
     // Do client request/response setup manually so we can override the usual exception handling
-    robot::v1::LogRequest req;
-    common::v1::LogEntry log;
-
-    *log.mutable_logger_name() = name;
-    log.set_level(level);
-    *log.mutable_message() = message;
-    *log.mutable_time() = to_proto(time);
-
-    auto& fields = *log.mutable_caller()->mutable_fields();
-    fields["Defined"].set_bool_value(true);
-    fields["File"].set_string_value(file);
-    fields["Line"].set_number_value(line);
-
-    req.mutable_logs()->Add(std::move(log));
-
+    const auto conn = impl_->current();
     robot::v1::LogResponse resp;
     ClientContext ctx;
-    const auto response = impl_->stub->Log(ctx, req, &resp);
+    const auto response = conn->stub->Log(ctx, req, &resp);
     if (is_error_response(response)) {
         // Manually override to force this to get logged to console so we don't set off an
         // infinite loop
         VIAM_SDK_LOG(error) << boost::log::add_value(sdk::impl::attr_console_force_type{}, true)
                             << "Error sending log message over grpc: " << response.error_message()
                             << response.error_details();
+        return false;
     }
+
+    return true;
 }
 
 bool RobotClient::send_traces(const robot::v1::SendTracesRequest* req) {
     if (!impl_) {
         return false;
     }
+    const auto conn = impl_->current();
     robot::v1::SendTracesResponse resp;
     ClientContext ctx;
-    return impl_->stub->SendTraces(ctx, *req, &resp).ok();
+    return conn->stub->SendTraces(ctx, *req, &resp).ok();
 }
 
 void RobotClient::connect_tracing() {
@@ -361,6 +439,12 @@ void RobotClient::connect_tracing() {
 
 std::shared_ptr<RobotClient> RobotClient::with_channel(ViamChannel channel,
                                                        const Options& options) {
+    return with_channel_at(std::move(channel), options, {});
+};
+
+std::shared_ptr<RobotClient> RobotClient::with_channel_at(ViamChannel channel,
+                                                          const Options& options,
+                                                          std::string address) {
     auto robot = std::make_shared<RobotClient>(std::move(channel));
     robot->refresh_interval_ = std::chrono::seconds{options.refresh_interval()};
     robot->should_refresh_ = (robot->refresh_interval_ > std::chrono::seconds{0});
@@ -368,12 +452,11 @@ std::shared_ptr<RobotClient> RobotClient::with_channel(ViamChannel channel,
         robot->refresh_thread_ = std::thread{&RobotClient::refresh_every, robot.get()};
     }
 
-    robot->should_check_connection_ = true;
-
     robot->check_every_interval_ = options.check_every_interval();
     robot->reconnect_every_interval_ = options.reconnect_every_interval();
-
-    robot->check_connection_thread_ = std::thread{&RobotClient::check_connection, robot.get()};
+    robot->address_ = std::move(address);
+    robot->dial_options_ = options.channel_options();
+    robot->watch_connection();
 
     robot->refresh();
     return robot;
@@ -382,8 +465,8 @@ std::shared_ptr<RobotClient> RobotClient::with_channel(ViamChannel channel,
 std::shared_ptr<RobotClient> RobotClient::at_address(const std::string& address,
                                                      const Options& options) {
     const char* uri = address.c_str();
-    auto robot = RobotClient::with_channel(
-        ViamChannel::dial_initial(uri, options.channel_options()), options);
+    auto robot = RobotClient::with_channel_at(
+        ViamChannel::dial_initial(uri, options.channel_options()), options, address);
 
     return robot;
 };
@@ -427,6 +510,85 @@ std::shared_ptr<Resource> RobotClient::resource_by_name(const Name& name) {
     return resource_manager_.resource(name.name());
 }
 
+namespace {
+
+// Completion times of the reads of a fan-out. Shared with the reads' completion callbacks, which may
+// run after the fan-out has given up on them.
+struct fan_out_progress {
+    explicit fan_out_progress(std::size_t size) : completed_at(size), remaining(size) {}
+
+    void complete(std::size_t i) {
+        const std::lock_guard<std::mutex> lock(mutex);
+        if (completed_at[i]) {
+            return;
+        }
+        completed_at[i] = std::chrono::steady_clock::now();
+        if (--remaining == 0) {
+            all_completed.notify_one();
+        }
+    }
+
+    std::mutex mutex;
+    std::condition_variable all_completed;
+    std::vector<boost::optional<std::chrono::steady_clock::time_point>> completed_at;
+    std::size_t remaining;
+};
+
+}  // namespace
+
+std::vector<RobotClient::fan_out_timing> RobotClient::fan_out_(
+    const std::vector<Name>& names,
+    std::chrono::milliseconds timeout,
+    const std::function<void(std::size_t, Resource&)>& start,
+    const std::function<bool(std::size_t)>& ready) {
+    const auto deadline = std::chrono::steady_clock::now() + timeout;
+    const auto call_deadline = std::chrono::system_clock::now() + timeout;
+
+    auto progress = std::make_shared<fan_out_progress>(names.size());
+    std::vector<std::chrono::steady_clock::time_point> started_at(names.size());
+    std::vector<fan_out_timing> timings(names.size());
+
+    for (std::size_t i = 0; i < names.size(); ++i) {
+        started_at[i] = std::chrono::steady_clock::now();
+        try {
+            const auto resource = resource_by_name(names[i]);
+            if (!resource) {
+                throw Exception(ErrorCondition::k_resource_not_found,
+                                "no resource named " + names[i].to_string());
+            }
+            const client_helper_details::CallScope scope(call_deadline,
+                                                         [progress, i] { progress->complete(i); });
+            start(i, *resource);
+        } catch (...) {
+            timings[i].error = std::current_exception();
+            progress->complete(i);
+            continue;
+        }
+        // Reads which are not made through invoke_async, such as those of resources served in this
+        // process, have already completed by the time `start` returns.
+        if (ready(i)) {
+            progress->complete(i);
+        }
+    }
+
+    std::unique_lock<std::mutex> lock(progress->mutex);
+    progress->all_completed.wait_until(lock, deadline, [&] { return progress->remaining == 0; });
+
+    for (std::size_t i = 0; i < names.size(); ++i) {
+        const auto& completed_at = progress->completed_at[i];
+        timings[i].completed = completed_at.has_value();
+        timings[i].latency = std::chrono::duration_cast<std::chrono::microseconds>(
+            (completed_at ? *completed_at : deadline) - started_at[i]);
+    }
+    return timings;
+}
+
+std::vector<RobotClient::read_result<ProtoStruct>> RobotClient::get_readings(
+    const std::vector<Name>& names, std::chrono::milliseconds timeout) {
+    return read_resources<Sensor>(
+        names, timeout, [](Sensor& sensor) { return sensor.get_readings_async(); });
+}
+
 void RobotClient::stop_all() {
     std::unordered_map<Name, ProtoStruct> map;
     for (const Name& name : resource_names()) {
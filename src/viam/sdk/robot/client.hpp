@@ -4,9 +4,19 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <future>
 #include <string>
 #include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
+#include <viam/sdk/common/exception.hpp>
 #include <viam/sdk/common/grpc_fwd.hpp>
 #include <viam/sdk/common/pose.hpp>
 #include <viam/sdk/common/proto_convert.hpp>
@@ -24,6 +34,7 @@ namespace robot {
 namespace v1 {
 
 class FrameSystemConfig;
+class LogRequest;
 class Operation;
 class SendTracesRequest;
 
@@ -73,6 +84,23 @@ class RobotClient {
         friend bool operator==(const operation& lhs, const operation& rhs);
     };
 
+    /// @struct read_result
+    /// @brief The outcome of reading one resource with `read_resources`.
+    template <typename T>
+    struct read_result {
+        Name name;
+
+        /// @brief The value read, or none if the read failed or did not finish in time.
+        boost::optional<T> value;
+
+        /// @brief Why the read failed, or null if it succeeded.
+        std::exception_ptr error;
+
+        /// @brief The time from starting the read to its completion, or to the deadline if it did
+        /// not complete in time.
+        std::chrono::microseconds latency{};
+    };
+
     explicit RobotClient(ViamChannel channel);
 
     ~RobotClient();
@@ -133,6 +161,28 @@ class RobotClient {
         return std::dynamic_pointer_cast<T>(resource_by_name({API::get<T>(), "", std::move(name)}));
     }
 
+    /// @brief Read many resources at once, waiting for at most `timeout`.
+    /// @param names The resources to read. Each must be a `ResourceType`.
+    /// @param timeout How long to wait for the reads. It is also the deadline of the gRPC calls
+    /// they make, so a read which does not finish in time is cancelled rather than left running.
+    /// @param read Starts the read of one resource, returning a `std::future` of its result. For
+    /// example `[](Motor& m) { return m.get_position_async(); }`, or
+    /// `[](Camera& c) { return c.get_images_async(); }`.
+    /// @return A result for each of `names`, in the same order.
+    /// @remark All of the reads are in flight together, so the whole call takes about as long as
+    /// the slowest read rather than the sum of them. A read which fails, including by naming a
+    /// resource which does not exist or is not a `ResourceType`, is reported in its result and does
+    /// not affect the others.
+    template <typename ResourceType, typename Read>
+    auto read_resources(const std::vector<Name>& names,
+                        std::chrono::milliseconds timeout,
+                        Read&& read);
+
+    /// @brief Get the readings of many sensors at once, waiting for at most `timeout`.
+    /// @remark This is `read_resources` with `Sensor::get_readings_async`.
+    std::vector<read_result<ProtoStruct>> get_readings(const std::vector<Name>& names,
+                                                       std::chrono::milliseconds timeout);
+
     /// @brief Get the configuration of the frame system of the given robot.
     /// @return The configuration of the calling robot's frame system.
     std::vector<frame_system_config> get_frame_system_config(
@@ -190,12 +240,8 @@ class RobotClient {
     friend struct impl::LogBackend;
     friend class impl::ParentSendTracesExporter;
 
-    void log(const std::string& name,
-             const std::string& level,
-             const std::string& message,
-             time_pt time,
-             const std::string& file,
-             unsigned int line);
+    // Ships a batch of log entries to the parent. Returns true on success.
+    bool send_logs(const robot::v1::LogRequest& req);
 
     // Ships a batch of OTLP traces to the parent. Returns true on success.
     bool send_traces(const robot::v1::SendTracesRequest* req);
@@ -207,23 +253,60 @@ class RobotClient {
     // re-enabled on destruction.
     void connect_logging();
 
+    // Ships any log records still queued by connect_logging and removes the sink. Called on close,
+    // while the connection to the parent is still usable.
+    void disconnect_logging();
+
     // Installs the SDK tracer provider so spans flow back to the parent over this connection.
     // Only called by ModuleService when running as a module.
     void connect_tracing();
 
+    static std::shared_ptr<RobotClient> with_channel_at(ViamChannel channel,
+                                                        const Options& options,
+                                                        std::string address);
+
     void refresh_every();
-    void check_connection();
+
+    // Registers this client's channel with the process-wide connection watcher, according to the
+    // check and reconnect intervals.
+    void watch_connection();
+
+    // Whether the robot answers a cheap RPC within `timeout`.
+    bool keepalive(std::chrono::seconds timeout);
+
+    // Makes one attempt to dial the robot again, returning the new channel or null.
+    std::shared_ptr<GrpcChannel> reconnect();
+
+    struct fan_out_timing {
+        std::chrono::microseconds latency;
+        bool completed;
+        std::exception_ptr error;
+    };
+
+    // The type-independent part of read_resources. Calls `start(i, resource)` for each `names[i]`
+    // with the calls it makes bounded by `timeout`, then waits until every read has completed or
+    // the timeout has passed. `ready(i)` reports whether the read started for `names[i]` has
+    // already completed.
+    std::vector<fan_out_timing> fan_out_(const std::vector<Name>& names,
+                                         std::chrono::milliseconds timeout,
+                                         const std::function<void(std::size_t, Resource&)>& start,
+                                         const std::function<bool(std::size_t)>& ready);
 
     std::thread refresh_thread_;
-    std::thread check_connection_thread_;
     std::atomic<bool> should_refresh_;
-    std::atomic<bool> should_check_connection_;
     std::chrono::seconds refresh_interval_;
     std::chrono::seconds check_every_interval_;
     std::chrono::seconds reconnect_every_interval_;
 
-    ViamChannel viam_channel_;
+    // The address and options to redial with. The address is empty if the client was made from a
+    // channel, in which case it cannot reconnect.
+    std::string address_;
+    boost::optional<ViamChannel::Options> dial_options_;
+
+    // The id of this client's connection watch, or zero if it has none.
+    std::uint64_t connection_watch_ = 0;
 
+    // Owns the connection to the robot, which a reconnect replaces.
     struct impl;
     std::unique_ptr<impl> impl_;
 
@@ -233,6 +316,52 @@ class RobotClient {
     ResourceManager resource_manager_;
 };
 
+template <typename ResourceType, typename Read>
+auto RobotClient::read_resources(const std::vector<Name>& names,
+                                 std::chrono::milliseconds timeout,
+                                 Read&& read) {
+    using future_type = decltype(std::declval<Read&>()(std::declval<ResourceType&>()));
+    using value_type = std::decay_t<decltype(std::declval<future_type&>().get())>;
+
+    std::vector<future_type> pending(names.size());
+    const auto timings = fan_out_(
+        names,
+        timeout,
+        [&](std::size_t i, Resource& resource) {
+            auto* const typed = dynamic_cast<ResourceType*>(&resource);
+            if (!typed) {
+                throw Exception(ErrorCondition::k_not_supported,
+                                names[i].to_string() + " is not a " +
+                                    API::get<ResourceType>().to_string());
+            }
+            pending[i] = read(*typed);
+        },
+        [&](std::size_t i) {
+            return pending[i].valid() &&
+                   pending[i].wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+        });
+
+    std::vector<read_result<value_type>> results(names.size());
+    for (std::size_t i = 0; i < names.size(); ++i) {
+        auto& result = results[i];
+        result.name = names[i];
+        result.latency = timings[i].latency;
+        if (timings[i].error) {
+            result.error = timings[i].error;
+        } else if (!timings[i].completed) {
+            result.error = std::make_exception_ptr(
+                Exception("reading " + names[i].to_string() + " did not complete in time"));
+        } else {
+            try {
+                result.value = pending[i].get();
+            } catch (...) {
+                result.error = std::current_exception();
+            }
+        }
+    }
+    return results;
+}
+
 namespace proto_convert_details {
 
 template <>
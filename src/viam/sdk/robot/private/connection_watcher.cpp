@@ -0,0 +1,384 @@
+#include <viam/sdk/robot/private/connection_watcher.hpp>
+
+#include <algorithm>
+#include <exception>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <grpcpp/alarm.h>
+#include <grpcpp/completion_queue.h>
+
+#include <viam/sdk/common/client_helper.hpp>
+#include <viam/sdk/log/logging.hpp>
+
+namespace viam {
+namespace sdk {
+namespace impl {
+
+namespace {
+
+using clock = std::chrono::steady_clock;
+
+// How long each state notification waits for a change before it is renewed. This bounds how long a
+// channel is kept alive after its watch ends, and how long destroying the watcher can take.
+constexpr std::chrono::seconds k_notify_timeout{1};
+
+// The longest wait between reconnect attempts, unless the reconnect interval itself is longer.
+constexpr std::chrono::minutes k_max_reconnect_backoff{1};
+
+bool is_failed(grpc_connectivity_state state) {
+    return state == GRPC_CHANNEL_TRANSIENT_FAILURE || state == GRPC_CHANNEL_SHUTDOWN;
+}
+
+// The wait before the next reconnect attempt after `failures` consecutive failed ones.
+clock::duration reconnect_backoff(std::chrono::milliseconds interval, int failures) {
+    const clock::duration cap = std::max<clock::duration>(k_max_reconnect_backoff, interval);
+    clock::duration backoff = interval;
+    for (int i = 1; i < failures && backoff < cap; ++i) {
+        backoff *= 2;
+    }
+    return std::min(backoff, cap);
+}
+
+}  // namespace
+
+struct ConnectionWatcher::entry {
+    entry(watch_id id, std::shared_ptr<grpc::Channel> channel, watch_options options)
+        : id(id), options(std::move(options)), channel(std::move(channel)) {}
+
+    const watch_id id;
+    const watch_options options;
+
+    // Held while one of the callbacks in `options` runs, and by unwatch, so that unwatch can wait
+    // for them to finish. Recursive so that a callback may end the watch itself.
+    std::recursive_mutex callback_lock;
+    bool cancelled = false;
+
+    // The rest are guarded by the lock of the watcher's state.
+    std::shared_ptr<grpc::Channel> channel;
+    bool connected = true;
+    // Set while the channel has not been READY since it last went into TRANSIENT_FAILURE, and
+    // when that happened.
+    bool failing = false;
+    clock::time_point failing_since;
+    // Set while a probe or reconnect attempt is in flight, or once the watch has given up.
+    bool busy = false;
+    int failed_attempts = 0;
+    clock::time_point next_keepalive;
+    clock::time_point next_reconnect;
+};
+
+struct ConnectionWatcher::notify_tag {
+    std::shared_ptr<entry> watched;
+    std::shared_ptr<grpc::Channel> channel;
+    grpc_connectivity_state last_state;
+};
+
+struct ConnectionWatcher::state {
+    std::mutex lock;
+    grpc::CompletionQueue cq;
+    // Wakes the watcher thread once a probe or reconnect attempt finishes, so that the next one is
+    // scheduled on time. Declared after `cq`, which it must not outlive.
+    grpc::Alarm wake_alarm;
+    bool wake_pending = false;
+    std::unordered_map<watch_id, std::shared_ptr<entry>> entries;
+    watch_id next_id = 1;
+    bool stopping = false;
+
+    // The members below must be called with `lock` held, except where noted.
+
+    bool is_watched(const entry& e) const {
+        const auto it = entries.find(e.id);
+        return it != entries.end() && it->second.get() == &e;
+    }
+
+    // Asks for a notification when the channel of `e` leaves `last_state`, or after a timeout.
+    void arm(const std::shared_ptr<entry>& e, grpc_connectivity_state last_state) {
+        if (stopping) {
+            return;
+        }
+        auto* tag = new notify_tag{e, e->channel, last_state};
+        tag->channel->NotifyOnStateChange(
+            last_state, std::chrono::system_clock::now() + k_notify_timeout, &cq, tag);
+    }
+
+    void wake() {
+        if (stopping || wake_pending) {
+            return;
+        }
+        wake_pending = true;
+        wake_alarm.Set(&cq, std::chrono::system_clock::now(), &wake_alarm);
+    }
+
+    void lost(entry& e, const char* why) {
+        e.connected = false;
+        e.next_reconnect = clock::now();
+        if (e.options.reconnect_interval.count() > 0) {
+            VIAM_SDK_LOG(error) << "Lost connection to " << e.options.name << ": " << why
+                                << ". Attempting to reconnect";
+        } else {
+            VIAM_SDK_LOG(error) << "Lost connection to " << e.options.name << ": " << why;
+        }
+    }
+
+    void restored(entry& e) {
+        if (!e.connected) {
+            VIAM_SDK_LOG(info) << "Connection to " << e.options.name << " restored";
+        }
+        e.connected = true;
+        e.failed_attempts = 0;
+        e.next_keepalive = clock::now() + e.options.keepalive_interval;
+    }
+
+    // Called on the watcher thread, without `lock` held.
+    void on_event(void* event_tag) {
+        const std::lock_guard<std::mutex> guard(lock);
+        if (event_tag == &wake_alarm) {
+            wake_pending = false;
+            return;
+        }
+
+        const std::unique_ptr<notify_tag> tag(static_cast<notify_tag*>(event_tag));
+        entry& e = *tag->watched;
+        // A notification for a channel which has since been replaced, or whose watch has ended,
+        // is dropped along with the tag's reference to it.
+        if (!is_watched(e) || tag->channel != e.channel) {
+            return;
+        }
+
+        // gRPC retries a channel in TRANSIENT_FAILURE by itself, and usually recovers it, so this
+        // only starts the clock. The connection is lost once the keepalive fails, or once the
+        // channel has stayed failed for the reconnect interval; see `run_timers`.
+        const grpc_connectivity_state current = e.channel->GetState(false);
+        if (current == GRPC_CHANNEL_READY) {
+            e.failing = false;
+        } else if (is_failed(current) && !e.failing) {
+            e.failing = true;
+            e.failing_since = clock::now();
+        }
+        if (!e.connected && !e.busy && current == GRPC_CHANNEL_READY) {
+            // gRPC recovered the channel by itself before a reconnect attempt was needed.
+            restored(e);
+        }
+        arm(tag->watched, current);
+    }
+
+    // Starts any probes and reconnect attempts which are due, and returns when the next one will
+    // be. Called on the watcher thread, without `lock` held.
+    clock::time_point run_timers(const std::shared_ptr<state>& self) {
+        std::vector<std::function<void()>> due;
+        const auto now = clock::now();
+        auto next = now + k_notify_timeout;
+        {
+            const std::lock_guard<std::mutex> guard(lock);
+            if (stopping) {
+                return next;
+            }
+            for (const auto& kv : entries) {
+                const auto& e = kv.second;
+                if (e->busy) {
+                    continue;
+                }
+                const bool reconnects = e->options.reconnect_interval.count() > 0;
+                if (e->connected && e->failing && reconnects) {
+                    const auto channel_deadline = e->failing_since + e->options.reconnect_interval;
+                    if (channel_deadline <= now) {
+                        lost(*e, "channel has not recovered from TRANSIENT_FAILURE");
+                    } else {
+                        next = std::min(next, channel_deadline);
+                    }
+                }
+                if (!e->connected && reconnects) {
+                    if (e->next_reconnect <= now) {
+                        e->busy = true;
+                        due.push_back([self, e] { self->reconnect(e); });
+                    } else {
+                        next = std::min(next, e->next_reconnect);
+                    }
+                } else if (e->options.keepalive_interval.count() > 0) {
+                    // Without reconnects, keep probing a lost connection to notice its recovery.
+                    if (e->next_keepalive <= now) {
+                        e->busy = true;
+                        due.push_back([self, e] { self->probe(e); });
+                    } else {
+                        next = std::min(next, e->next_keepalive);
+                    }
+                }
+            }
+        }
+        for (auto& task : due) {
+            client_helper_details::post_blocking_call(std::move(task));
+        }
+        return next;
+    }
+
+    // Runs on the blocking call pool, without `lock` held.
+    void probe(const std::shared_ptr<entry>& e) {
+        bool alive = false;
+        {
+            const std::lock_guard<std::recursive_mutex> callback_guard(e->callback_lock);
+            if (e->cancelled) {
+                return;
+            }
+            try {
+                alive = e->options.keepalive();
+            } catch (const std::exception&) {
+            }
+        }
+
+        const std::lock_guard<std::mutex> guard(lock);
+        e->busy = false;
+        e->next_keepalive = clock::now() + e->options.keepalive_interval;
+        wake();
+        if (!is_watched(*e)) {
+            return;
+        }
+        if (alive) {
+            restored(*e);
+        } else if (e->connected) {
+            lost(*e, "keepalive failed");
+        }
+    }
+
+    // Runs on the blocking call pool, without `lock` held.
+    void reconnect(const std::shared_ptr<entry>& e) {
+        std::shared_ptr<grpc::Channel> channel;
+        {
+            const std::lock_guard<std::recursive_mutex> callback_guard(e->callback_lock);
+            if (e->cancelled) {
+                return;
+            }
+            try {
+                channel = e->options.reconnect();
+            } catch (const std::exception& exc) {
+                VIAM_SDK_LOG(debug)
+                    << "Failed to reconnect to " << e->options.name << ": " << exc.what();
+            }
+        }
+
+        {
+            const std::lock_guard<std::mutex> guard(lock);
+            if (!is_watched(*e)) {
+                return;
+            }
+            if (channel) {
+                e->busy = false;
+                e->channel = std::move(channel);
+                e->failing = false;
+                restored(*e);
+                arm(e, e->channel->GetState(false));
+                wake();
+                return;
+            }
+
+            ++e->failed_attempts;
+            const int max_attempts = e->options.max_reconnect_attempts;
+            if (max_attempts <= 0 || e->failed_attempts < max_attempts) {
+                e->busy = false;
+                e->next_reconnect =
+                    clock::now() +
+                    reconnect_backoff(e->options.reconnect_interval, e->failed_attempts);
+                wake();
+                return;
+            }
+        }
+
+        // Out of attempts. The entry stays busy, so nothing more is scheduled for it.
+        VIAM_SDK_LOG(error) << "Giving up reconnecting to " << e->options.name << " after "
+                            << e->failed_attempts << " attempts";
+        const std::lock_guard<std::recursive_mutex> callback_guard(e->callback_lock);
+        if (!e->cancelled && e->options.on_give_up) {
+            try {
+                e->options.on_give_up();
+            } catch (const std::exception& exc) {
+                VIAM_SDK_LOG(error) << "Error after giving up on " << e->options.name << ": "
+                                    << exc.what();
+            }
+        }
+    }
+};
+
+ConnectionWatcher& ConnectionWatcher::get() {
+    static ConnectionWatcher watcher;
+    return watcher;
+}
+
+ConnectionWatcher::ConnectionWatcher()
+    : state_(std::make_shared<state>()), thread_([s = state_] { run_(s); }) {}
+
+ConnectionWatcher::~ConnectionWatcher() {
+    {
+        const std::lock_guard<std::mutex> guard(state_->lock);
+        state_->stopping = true;
+    }
+    // Outstanding notifications are delivered, and dropped, before the queue reports shutdown.
+    state_->cq.Shutdown();
+    thread_.join();
+}
+
+ConnectionWatcher::watch_id ConnectionWatcher::watch(std::shared_ptr<grpc::Channel> channel,
+                                                     watch_options options) {
+    const std::lock_guard<std::mutex> guard(state_->lock);
+    auto e = std::make_shared<entry>(state_->next_id++, std::move(channel), std::move(options));
+    e->next_keepalive = clock::now() + e->options.keepalive_interval;
+    state_->entries.emplace(e->id, e);
+    state_->arm(e, e->channel->GetState(false));
+    return e->id;
+}
+
+void ConnectionWatcher::unwatch(watch_id id) {
+    std::shared_ptr<entry> e;
+    {
+        const std::lock_guard<std::mutex> guard(state_->lock);
+        const auto it = state_->entries.find(id);
+        if (it == state_->entries.end()) {
+            return;
+        }
+        e = it->second;
+    }
+
+    // The entry is only removed once it is cancelled, so that a concurrent call for the same watch
+    // finds it as well, and waits here for the callback in flight too.
+    {
+        const std::lock_guard<std::recursive_mutex> callback_guard(e->callback_lock);
+        e->cancelled = true;
+    }
+
+    const std::lock_guard<std::mutex> guard(state_->lock);
+    const auto it = state_->entries.find(id);
+    if (it != state_->entries.end() && it->second == e) {
+        state_->entries.erase(it);
+    }
+}
+
+bool ConnectionWatcher::connected(watch_id id) const {
+    const std::lock_guard<std::mutex> guard(state_->lock);
+    const auto it = state_->entries.find(id);
+    return it != state_->entries.end() && it->second->connected;
+}
+
+void ConnectionWatcher::run_(const std::shared_ptr<state>& s) {
+    for (;;) {
+        const auto next_timer = s->run_timers(s);
+        void* tag = nullptr;
+        bool ok = false;
+        const auto status = s->cq.AsyncNext(
+            &tag,
+            &ok,
+            std::chrono::system_clock::now() +
+                std::chrono::duration_cast<std::chrono::system_clock::duration>(next_timer -
+                                                                                clock::now()));
+        if (status == grpc::CompletionQueue::SHUTDOWN) {
+            return;
+        }
+        if (status == grpc::CompletionQueue::GOT_EVENT) {
+            s->on_event(tag);
+        }
+    }
+}
+
+}  // namespace impl
+}  // namespace sdk
+}  // namespace viam
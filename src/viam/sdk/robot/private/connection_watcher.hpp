@@ -0,0 +1,87 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <thread>
+
+#include <grpcpp/channel.h>
+
+namespace viam {
+namespace sdk {
+namespace impl {
+
+// Watches the connections of every RobotClient in the process from a single thread. Rather than
+// polling with RPCs, it waits on gRPC's connectivity state notifications for each channel. gRPC
+// recovers a channel in TRANSIENT_FAILURE by itself after a short network blip, so a connection
+// only counts as lost once its keepalive probe fails, or once its channel has stayed failed for the
+// reconnect interval. It is then redialed with exponential backoff. The keepalive probe also
+// catches connections which have died without the channel noticing.
+// Probes and reconnects block, so they run on the pool of client_helper_details::post_blocking_call
+// rather than on the watcher thread, and never on the thread of a caller.
+class ConnectionWatcher {
+   public:
+    struct watch_options {
+        // Identifies the connection in log messages.
+        std::string name;
+
+        // How often to probe a healthy connection with `keepalive`. Zero disables probing.
+        std::chrono::milliseconds keepalive_interval{0};
+
+        // Returns whether the robot answered a cheap RPC.
+        std::function<bool()> keepalive;
+
+        // How long a channel may stay failed before the connection counts as lost, and how long to
+        // wait after the first failed reconnect attempt. The wait doubles after each further
+        // failure. Zero disables reconnecting, leaving gRPC to recover the channel itself.
+        std::chrono::milliseconds reconnect_interval{0};
+
+        // Makes one attempt to reconnect, returning the new channel to watch, or null on failure.
+        std::function<std::shared_ptr<grpc::Channel>()> reconnect;
+
+        // Consecutive failed attempts after which the watch ends with a call to `on_give_up`.
+        int max_reconnect_attempts = 3;
+
+        std::function<void()> on_give_up;
+    };
+
+    using watch_id = std::uint64_t;
+
+    static ConnectionWatcher& get();
+
+    ~ConnectionWatcher();
+
+    ConnectionWatcher(const ConnectionWatcher&) = delete;
+    ConnectionWatcher& operator=(const ConnectionWatcher&) = delete;
+
+    watch_id watch(std::shared_ptr<grpc::Channel> channel, watch_options options);
+
+    // Ends a watch. Once this returns, none of the watch's callbacks are running or will run,
+    // unless it was called from one of them. This holds even when another call to unwatch for the
+    // same watch is still waiting for a callback to finish.
+    void unwatch(watch_id id);
+
+    // Whether the connection of a watch is up, as far as the watcher knows. False once the watch
+    // has ended.
+    bool connected(watch_id id) const;
+
+   private:
+    struct entry;
+    struct notify_tag;
+    struct state;
+
+    ConnectionWatcher();
+
+    static void run_(const std::shared_ptr<state>& s);
+
+    // Shared with the watcher thread and with the probes and reconnects in flight, any of which may
+    // outlive the watcher itself during static destruction.
+    std::shared_ptr<state> state_;
+    std::thread thread_;
+};
+
+}  // namespace impl
+}  // namespace sdk
+}  // namespace viam
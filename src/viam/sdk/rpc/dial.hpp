@@ -159,14 +159,21 @@ class Options {
 
     /// @brief Sets how often to verify connectivity to the robot, in seconds. If set to 0, will not
     /// check, will default to the `reconnect_every_interval_` value. Defaults to 0.
-    /// @note Setting to a non-zero value is useful in modules but may result in delays shutting
-    /// down client code
+    /// @remark Connections are watched through gRPC's connectivity state notifications, on one
+    /// thread shared by all robot clients. This interval sets how often a small keepalive RPC is
+    /// sent as well, to catch connections which have died without the channel noticing.
+    /// @note Setting to a non-zero value may delay closing the client by up to one keepalive RPC,
+    /// which is given this interval to complete.
     Options& set_check_every_interval(std::chrono::seconds interval);
 
-    /// @brief Sets how often to attempt to reconnect to the robot when disconnected. If set to 0,
-    /// will not attempt to reconnect. Defaults to 0.
-    /// @note Setting to a non-zero value is useful in modules but may result in delays shutting
-    /// down client code
+    /// @brief Sets how long to wait before the second attempt to reconnect to the robot once the
+    /// connection is lost. Further attempts back off exponentially. After three attempts fail,
+    /// the client stops refreshing and its calls throw, until it is closed. If set to 0, will not
+    /// attempt to reconnect. Defaults to 0.
+    /// @remark The connection is lost once a keepalive RPC fails, or once gRPC has failed to
+    /// recover the channel for this long. Reconnecting replaces every resource client; clients
+    /// obtained before then keep using the old connection.
+    /// @remark Reconnecting requires a client made with `RobotClient::at_address`.
     Options& set_reconnect_every_interval(std::chrono::seconds interval);
 
     [[deprecated("Please update your function calls to channel_options")]]  //
@@ -0,0 +1,67 @@
+#include <viam/sdk/rpc/private/executor.hpp>
+
+#include <algorithm>
+
+#include <viam/sdk/log/logging.hpp>
+
+namespace viam {
+namespace sdk {
+namespace impl {
+
+Executor::Executor(std::size_t threads) {
+    if (threads == 0) {
+        threads = std::max(1U, std::thread::hardware_concurrency());
+    }
+
+    workers_.reserve(threads);
+    for (std::size_t i = 0; i < threads; ++i) {
+        workers_.emplace_back(&Executor::run_, this);
+    }
+}
+
+Executor::~Executor() {
+    {
+        const std::lock_guard<std::mutex> lock(lock_);
+        stopping_ = true;
+    }
+    cv_.notify_all();
+
+    for (auto& worker : workers_) {
+        worker.join();
+    }
+}
+
+void Executor::post(std::function<void()> task) {
+    {
+        const std::lock_guard<std::mutex> lock(lock_);
+        tasks_.push_back(std::move(task));
+    }
+    cv_.notify_one();
+}
+
+void Executor::run_() {
+    std::unique_lock<std::mutex> lock(lock_);
+    while (true) {
+        cv_.wait(lock, [this] { return stopping_ || !tasks_.empty(); });
+        if (tasks_.empty()) {
+            return;
+        }
+
+        auto task = std::move(tasks_.front());
+        tasks_.pop_front();
+
+        lock.unlock();
+        try {
+            task();
+        } catch (const std::exception& xcp) {
+            VIAM_SDK_LOG(error) << "Uncaught exception in executor task: " << xcp.what();
+        } catch (...) {
+            VIAM_SDK_LOG(error) << "Uncaught unknown exception in executor task";
+        }
+        lock.lock();
+    }
+}
+
+}  // namespace impl
+}  // namespace sdk
+}  // namespace viam
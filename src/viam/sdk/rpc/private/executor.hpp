@@ -0,0 +1,48 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace viam {
+namespace sdk {
+namespace impl {
+
+// A fixed-size pool of threads which run posted tasks in FIFO order. Used for work which should
+// not block its caller, such as blocking client calls, camera frame prefetching and parallel
+// tensor preprocessing.
+class Executor {
+   public:
+    // Starts `threads` workers, or one per hardware thread if `threads` is zero.
+    explicit Executor(std::size_t threads);
+
+    // Runs any tasks which are still queued, then joins the workers.
+    ~Executor();
+
+    Executor(const Executor&) = delete;
+    Executor& operator=(const Executor&) = delete;
+
+    void post(std::function<void()> task);
+
+    std::size_t size() const noexcept {
+        return workers_.size();
+    }
+
+   private:
+    void run_();
+
+    std::mutex lock_;
+    std::condition_variable cv_;
+    std::deque<std::function<void()>> tasks_;
+    bool stopping_{false};
+
+    std::vector<std::thread> workers_;
+};
+
+}  // namespace impl
+}  // namespace sdk
+}  // namespace viam
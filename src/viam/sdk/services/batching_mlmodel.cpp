@@ -0,0 +1,385 @@
+#include <viam/sdk/services/batching_mlmodel.hpp>
+
+#include <algorithm>
+#include <exception>
+#include <sstream>
+#include <type_traits>
+#include <utility>
+
+#include <boost/variant/apply_visitor.hpp>
+#include <boost/variant/get.hpp>
+#include <boost/variant/static_visitor.hpp>
+
+#include <viam/sdk/common/exception.hpp>
+
+namespace viam {
+namespace sdk {
+
+namespace {
+
+using clock = std::chrono::steady_clock;
+
+class shape_visitor : public boost::static_visitor<std::vector<std::size_t>> {
+   public:
+    template <typename View>
+    std::vector<std::size_t> operator()(const View& t) const {
+        return {t.shape().begin(), t.shape().end()};
+    }
+};
+
+std::vector<std::size_t> shape_of(const MLModelService::tensor_views& view) {
+    return boost::apply_visitor(shape_visitor{}, view);
+}
+
+// Computes the signature which requests must share to be batched together, and the number of
+// rows in `inputs`. Returns false if the inputs cannot be batched: each needs at least one
+// dimension, and all must agree on the size of the first.
+bool describe(const MLModelService::named_tensor_views& inputs,
+              std::string* signature,
+              std::size_t* rows) {
+    if (inputs.empty()) {
+        return false;
+    }
+
+    std::vector<const MLModelService::named_tensor_views::value_type*> sorted;
+    sorted.reserve(inputs.size());
+    for (const auto& input : inputs) {
+        sorted.push_back(&input);
+    }
+    std::sort(sorted.begin(), sorted.end(), [](const auto* a, const auto* b) {
+        return a->first < b->first;
+    });
+
+    std::ostringstream buffer;
+    *rows = 0;
+    for (const auto* input : sorted) {
+        const auto shape = shape_of(input->second);
+        if (shape.empty() || shape.front() == 0 || (*rows != 0 && shape.front() != *rows)) {
+            return false;
+        }
+        *rows = shape.front();
+
+        buffer << input->first << '\0'
+               << MLModelService::tensor_info::tensor_views_to_data_type(input->second);
+        for (auto dim = std::next(shape.begin()); dim != shape.end(); ++dim) {
+            buffer << ',' << *dim;
+        }
+        buffer << ';';
+    }
+    *signature = buffer.str();
+    return true;
+}
+
+// Views rows [first_row, first_row + rows) of a tensor.
+class rows_visitor : public boost::static_visitor<MLModelService::tensor_views> {
+   public:
+    rows_visitor(std::size_t first_row, std::size_t rows) : first_row_(first_row), rows_(rows) {}
+
+    template <typename View>
+    MLModelService::tensor_views operator()(const View& t) const {
+        std::vector<std::size_t> shape(t.shape().begin(), t.shape().end());
+        const std::size_t row_size = t.size() / shape.front();
+        shape.front() = rows_;
+        return MLModelService::make_tensor_view(
+            t.data() + first_row_ * row_size, rows_ * row_size, std::move(shape));
+    }
+
+   private:
+    std::size_t first_row_;
+    std::size_t rows_;
+};
+
+}  // namespace
+
+struct BatchingMLModelService::request {
+    const named_tensor_views* inputs = nullptr;
+    std::string signature;
+    std::size_t rows = 0;
+    clock::time_point enqueued;
+
+    // Set once a batch has claimed this request, and once that batch has run.
+    bool taken = false;
+    bool done = false;
+
+    std::shared_ptr<named_tensor_views> result;
+    std::exception_ptr error;
+};
+
+namespace {
+
+// The concatenated inputs of a batch. The outputs of some models alias their inputs, so every
+// caller's result keeps these alive.
+struct batch_inputs {
+    std::vector<std::shared_ptr<void>> storage;
+    MLModelService::named_tensor_views views;
+};
+
+struct split_result {
+    std::shared_ptr<batch_inputs> inputs;
+    std::shared_ptr<MLModelService::named_tensor_views> outputs;
+    MLModelService::named_tensor_views views;
+};
+
+// Concatenates the tensor named `name` of each request in a batch along its first dimension.
+template <typename Request>
+class concatenate_visitor : public boost::static_visitor<MLModelService::tensor_views> {
+   public:
+    concatenate_visitor(const std::vector<Request*>& batch,
+                        const std::string& name,
+                        batch_inputs* inputs)
+        : batch_(batch), name_(name), inputs_(inputs) {}
+
+    template <typename View>
+    MLModelService::tensor_views operator()(const View& first) const {
+        using T = std::remove_const_t<typename View::value_type>;
+
+        std::size_t size = 0;
+        for (const Request* r : batch_) {
+            size += boost::get<View>(r->inputs->at(name_)).size();
+        }
+
+        auto storage = std::make_shared<std::vector<T>>();
+        storage->reserve(size);
+        std::size_t rows = 0;
+        for (const Request* r : batch_) {
+            const auto& view = boost::get<View>(r->inputs->at(name_));
+            storage->insert(storage->end(), view.data(), view.data() + view.size());
+            rows += r->rows;
+        }
+
+        std::vector<std::size_t> shape(first.shape().begin(), first.shape().end());
+        shape.front() = rows;
+        const T* data = storage->data();
+        inputs_->storage.push_back(std::move(storage));
+        return MLModelService::make_tensor_view(data, size, std::move(shape));
+    }
+
+   private:
+    const std::vector<Request*>& batch_;
+    const std::string& name_;
+    batch_inputs* inputs_;
+};
+
+}  // namespace
+
+BatchingMLModelService::BatchingMLModelService(std::string name,
+                                               std::shared_ptr<MLModelService> model)
+    : BatchingMLModelService(std::move(name), std::move(model), options{}) {}
+
+BatchingMLModelService::BatchingMLModelService(std::string name,
+                                               std::shared_ptr<MLModelService> model,
+                                               options opts)
+    : MLModelService(std::move(name)), model_(std::move(model)), options_(opts) {
+    if (!model_) {
+        throw Exception("BatchingMLModelService requires a model to wrap");
+    }
+    if (options_.max_batch_size == 0) {
+        throw Exception("BatchingMLModelService requires a max_batch_size of at least 1");
+    }
+}
+
+std::shared_ptr<MLModelService::named_tensor_views> BatchingMLModelService::infer(
+    const named_tensor_views& inputs, const ProtoStruct& extra) {
+    request self;
+    self.inputs = &inputs;
+    if (!extra.empty() || !describe(inputs, &self.signature, &self.rows) ||
+        self.rows > options_.max_batch_size || !accepts_batches_()) {
+        {
+            const std::lock_guard<std::mutex> guard(lock_);
+            ++stats_.unbatched_requests;
+        }
+        return model_->infer(inputs, extra);
+    }
+
+    std::unique_lock<std::mutex> lock(lock_);
+    self.enqueued = clock::now();
+    queue_.push_back(&self);
+    cv_.notify_all();
+
+    while (!self.done) {
+        // Wait while another request gathers a batch which this one may join, or while the batch
+        // which took this one runs.
+        if (self.taken || gathering_.count(self.signature) != 0) {
+            cv_.wait(lock);
+            continue;
+        }
+
+        // Gather a batch starting with this request.
+        gathering_.insert(self.signature);
+        cv_.wait_until(lock, self.enqueued + options_.max_queue_delay, [&] {
+            std::size_t rows = 0;
+            for (const request* r : queue_) {
+                if (r->signature == self.signature) {
+                    rows += r->rows;
+                }
+            }
+            return rows >= options_.max_batch_size;
+        });
+
+        std::vector<request*> batch{&self};
+        std::size_t rows = self.rows;
+        self.taken = true;
+        for (auto it = queue_.begin(); it != queue_.end();) {
+            request* r = *it;
+            if (r == &self) {
+                it = queue_.erase(it);
+            } else if (r->signature == self.signature &&
+                       rows + r->rows <= options_.max_batch_size) {
+                r->taken = true;
+                rows += r->rows;
+                batch.push_back(r);
+                it = queue_.erase(it);
+            } else {
+                ++it;
+            }
+        }
+
+        const auto now = clock::now();
+        ++stats_.batches;
+        stats_.batched_requests += batch.size();
+        stats_.batched_rows += rows;
+        stats_.largest_batch = std::max(stats_.largest_batch, rows);
+        for (const request* r : batch) {
+            const auto delay =
+                std::chrono::duration_cast<std::chrono::microseconds>(now - r->enqueued);
+            stats_.total_queue_delay += delay;
+            stats_.longest_queue_delay = std::max(stats_.longest_queue_delay, delay);
+        }
+
+        // Let the next batch with this signature start gathering while this one runs.
+        gathering_.erase(self.signature);
+        cv_.notify_all();
+
+        lock.unlock();
+        run_batch_(batch);
+        lock.lock();
+
+        for (request* r : batch) {
+            r->done = true;
+        }
+        cv_.notify_all();
+    }
+
+    lock.unlock();
+    if (self.error) {
+        std::rethrow_exception(self.error);
+    }
+    return std::move(self.result);
+}
+
+void BatchingMLModelService::run_batch_(const std::vector<request*>& batch) {
+    try {
+        if (batch.size() == 1) {
+            batch.front()->result = model_->infer(*batch.front()->inputs, {});
+            return;
+        }
+
+        auto inputs = std::make_shared<batch_inputs>();
+        std::size_t total_rows = 0;
+        for (const request* r : batch) {
+            total_rows += r->rows;
+        }
+        for (const auto& input : *batch.front()->inputs) {
+            const concatenate_visitor<request> concatenate{batch, input.first, inputs.get()};
+            inputs->views.emplace(input.first, boost::apply_visitor(concatenate, input.second));
+        }
+
+        const std::shared_ptr<named_tensor_views> outputs = model_->infer(inputs->views, {});
+        for (const auto& output : *outputs) {
+            const auto shape = shape_of(output.second);
+            if (shape.empty() || shape.front() != total_rows) {
+                std::ostringstream message;
+                message << "Cannot split output `" << output.first << "` of a batch of "
+                        << total_rows << " rows: its leading dimension is "
+                        << (shape.empty() ? 0 : shape.front());
+                throw Exception(message.str());
+            }
+        }
+
+        std::size_t first_row = 0;
+        for (request* r : batch) {
+            auto split = std::make_shared<split_result>();
+            split->inputs = inputs;
+            split->outputs = outputs;
+            for (const auto& output : *outputs) {
+                split->views.emplace(
+                    output.first,
+                    boost::apply_visitor(rows_visitor{first_row, r->rows}, output.second));
+            }
+            first_row += r->rows;
+
+            auto* const views = &split->views;
+            r->result = std::shared_ptr<named_tensor_views>(std::move(split), views);
+        }
+    } catch (...) {
+        const auto error = std::current_exception();
+        for (request* r : batch) {
+            r->error = error;
+        }
+    }
+}
+
+struct MLModelService::metadata BatchingMLModelService::metadata(const ProtoStruct& extra) {
+    return model_->metadata(extra);
+}
+
+ProtoStruct BatchingMLModelService::get_status() {
+    ProtoStruct status = model_->get_status();
+
+    statistics stats;
+    {
+        const std::lock_guard<std::mutex> guard(lock_);
+        stats = stats_;
+    }
+
+    const auto ms = [](std::chrono::microseconds us) { return us.count() / 1000.0; };
+    const double batches = static_cast<double>(stats.batches);
+    const double batched_requests = static_cast<double>(stats.batched_requests);
+
+    status["batching"] = ProtoStruct{
+        {"max_batch_size", static_cast<double>(options_.max_batch_size)},
+        {"max_queue_delay_ms", ms(options_.max_queue_delay)},
+        {"batches", batches},
+        {"batched_requests", batched_requests},
+        {"unbatched_requests", static_cast<double>(stats.unbatched_requests)},
+        {"mean_batch_size", batches > 0 ? stats.batched_rows / batches : 0.0},
+        {"largest_batch_size", static_cast<double>(stats.largest_batch)},
+        {"mean_queue_delay_ms",
+         batched_requests > 0 ? ms(stats.total_queue_delay) / batched_requests : 0.0},
+        {"longest_queue_delay_ms", ms(stats.longest_queue_delay)},
+    };
+    return status;
+}
+
+bool BatchingMLModelService::accepts_batches_() {
+    const std::uint64_t generation = model_->metadata_generation();
+    {
+        const std::lock_guard<std::mutex> guard(lock_);
+        if (checked_ && checked_generation_ == generation) {
+            return batchable_;
+        }
+    }
+
+    const struct metadata md = model_->metadata({});
+    const bool batchable =
+        std::all_of(md.inputs.begin(), md.inputs.end(), [](const tensor_info& info) {
+            return info.shape.empty() || info.shape.front() < 0;
+        });
+
+    bool changed = false;
+    {
+        const std::lock_guard<std::mutex> guard(lock_);
+        changed = checked_ && checked_generation_ != generation;
+        checked_ = true;
+        checked_generation_ = generation;
+        batchable_ = batchable;
+    }
+    if (changed) {
+        // The wrapped model's metadata changed, so this service's metadata did too.
+        metadata_changed();
+    }
+    return batchable;
+}
+
+}  // namespace sdk
+}  // namespace viam
@@ -0,0 +1,100 @@
+/// @file services/batching_mlmodel.hpp
+///
+/// @brief Defines `BatchingMLModelService`, which coalesces concurrent inference requests.
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include <viam/sdk/services/mlmodel.hpp>
+
+namespace viam {
+namespace sdk {
+
+/// @class BatchingMLModelService batching_mlmodel.hpp "services/batching_mlmodel.hpp"
+/// @brief Wraps an `MLModelService` whose inputs have a dynamic leading (batch) dimension, and
+/// runs concurrent `infer` calls against it as one batch.
+///
+/// Calls are batched together when their inputs have the same names, data types and trailing
+/// shapes, and carry no `extra`. The first call of a batch waits up to `max_queue_delay` for
+/// others to join it, or until `max_batch_size` rows have been queued. The inputs are then
+/// concatenated along their first dimension, the wrapped model runs once, and each caller gets
+/// the rows of every output which belong to it.
+///
+/// Calls which cannot be batched go straight to the wrapped model. That includes every call if
+/// the model's metadata declares a fixed leading dimension for any input. A model compiled with a
+/// fixed batch size is therefore never batched, and neither is a model whose service reports the
+/// concrete shapes of its allocated tensors rather than their signatures, as the TFLite example
+/// module does. Such a model should be wrapped only once its service reports a leading dimension
+/// of -1 and accepts inputs of any batch size.
+///
+/// `get_status` returns the status of the wrapped model, with batching statistics added under
+/// the `batching` key.
+class BatchingMLModelService : public MLModelService {
+   public:
+    struct options {
+        /// @brief The most rows, summed over the leading dimension of each call's inputs, to run
+        /// in one batch.
+        std::size_t max_batch_size = 8;
+
+        /// @brief How long the first call of a batch waits for others to join it.
+        std::chrono::microseconds max_queue_delay{2000};
+    };
+
+    BatchingMLModelService(std::string name, std::shared_ptr<MLModelService> model);
+    BatchingMLModelService(std::string name,
+                           std::shared_ptr<MLModelService> model,
+                           options opts);
+
+    using MLModelService::infer;
+    std::shared_ptr<named_tensor_views> infer(const named_tensor_views& inputs,
+                                              const ProtoStruct& extra) override;
+
+    using MLModelService::metadata;
+    struct metadata metadata(const ProtoStruct& extra) override;
+
+    ProtoStruct get_status() override;
+
+   private:
+    struct request;
+    struct statistics {
+        std::uint64_t batches = 0;
+        std::uint64_t batched_requests = 0;
+        std::uint64_t batched_rows = 0;
+        std::uint64_t unbatched_requests = 0;
+        std::size_t largest_batch = 0;
+        std::chrono::microseconds total_queue_delay{0};
+        std::chrono::microseconds longest_queue_delay{0};
+    };
+
+    // Whether the wrapped model accepts any number of rows, according to its metadata.
+    bool accepts_batches_();
+
+    void run_batch_(const std::vector<request*>& batch);
+
+    const std::shared_ptr<MLModelService> model_;
+    const options options_;
+
+    std::mutex lock_;
+    std::condition_variable cv_;
+    std::deque<request*> queue_;
+    // The signatures of the requests for which a batch is currently being gathered.
+    std::unordered_set<std::string> gathering_;
+    statistics stats_;
+
+    // The metadata generation of the wrapped model when `accepts_batches_` was last computed.
+    std::uint64_t checked_generation_ = 0;
+    bool checked_ = false;
+    bool batchable_ = false;
+};
+
+}  // namespace sdk
+}  // namespace viam
@@ -14,6 +14,8 @@
 
 #pragma once
 
+#include <atomic>
+#include <cstdint>
 #include <iosfwd>
 
 #include <boost/mpl/joint_view.hpp>
@@ -174,8 +176,28 @@ class MLModelService : public Service {
     /// @return A `ProtoStruct` containing the status of the mlmodel service.
     virtual ProtoStruct get_status() = 0;
 
+    /// @brief Returns a counter which changes whenever the model's metadata may have changed.
+    ///
+    /// Callers which cache the result of `metadata`, such as the server which serves this
+    /// service to viam-server, compare this value to decide whether their cache is stale.
+    std::uint64_t metadata_generation() const noexcept {
+        return metadata_generation_.load(std::memory_order_acquire);
+    }
+
    protected:
     explicit MLModelService(std::string name);
+
+    /// @brief Signals that subsequent calls to `metadata` may return different results.
+    ///
+    /// Implementations whose metadata can change after construction, for instance by
+    /// reconfiguring in place, must call this so that cached copies of the metadata are
+    /// refreshed.
+    void metadata_changed() noexcept {
+        metadata_generation_.fetch_add(1, std::memory_order_acq_rel);
+    }
+
+   private:
+    std::atomic<std::uint64_t> metadata_generation_{0};
 };
 
 template <>
@@ -14,12 +14,21 @@
 
 #include <viam/sdk/services/private/mlmodel.hpp>
 
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
 #include <memory>
+#include <mutex>
 #include <stack>
 #include <stdexcept>
+#include <string>
 #include <type_traits>
 #include <utility>
 
+#include <boost/endian/conversion.hpp>
 #include <boost/variant/get.hpp>
 
 #include <viam/sdk/common/exception.hpp>
@@ -31,6 +40,58 @@ namespace mlmodel {
 
 namespace {
 
+constexpr bool is_little_endian() {
+    return boost::endian::order::native == boost::endian::order::little;
+}
+
+// Whether the elements of `t` are laid out in memory in the order the API expects them, so that
+// they can be copied in bulk.
+template <typename View>
+bool is_row_major(const View& t) {
+    return t.layout() == xt::layout_type::row_major;
+}
+
+// Replaces the contents of `field` with the elements of `t`.
+template <typename View, typename Field>
+void copy_elements(const View& t, Field* field) {
+    const int size = static_cast<int>(t.size());
+    field->Clear();
+    field->Reserve(size);
+    auto* const out = field->AddNAlreadyReserved(size);
+    if (is_row_major(t)) {
+        std::memcpy(out, t.data(), t.size() * sizeof(*out));
+    } else {
+        std::copy(t.begin(), t.end(), out);
+    }
+}
+
+// Replaces the contents of `field` with the 16-bit elements of `t`, packed two to a word with
+// the first in the low half, as the API expects. If there is an odd number of elements the high
+// half of the last word is zero.
+template <typename View>
+void pack_16_bit_elements(const View& t, ::google::protobuf::RepeatedField<std::uint32_t>* field) {
+    const int num32s = static_cast<int>((t.size() + 1) / 2);
+    field->Clear();
+    field->Reserve(num32s);
+    std::uint32_t* const out = field->AddNAlreadyReserved(num32s);
+    if (num32s == 0) {
+        return;
+    }
+
+    if (is_little_endian() && is_row_major(t)) {
+        out[num32s - 1] = 0;
+        std::memcpy(out, t.data(), t.size() * sizeof(std::uint16_t));
+        return;
+    }
+
+    std::fill(out, out + num32s, 0);
+    std::size_t i = 0;
+    for (const auto value : t) {
+        out[i / 2] |= std::uint32_t{static_cast<std::uint16_t>(value)} << (16 * (i % 2));
+        ++i;
+    }
+}
+
 class copy_sdk_tensor_to_api_tensor_visitor : public boost::static_visitor<void> {
    public:
     explicit copy_sdk_tensor_to_api_tensor_visitor(::viam::service::mlmodel::v1::FlatTensor* target)
@@ -44,93 +105,185 @@ class copy_sdk_tensor_to_api_tensor_visitor : public boost::static_visitor<void>
     }
 
    private:
+    template <typename View>
+    static void copy_bytes_(const View& t, std::string* data) {
+        if (is_row_major(t)) {
+            data->assign(reinterpret_cast<const char*>(t.data()), t.size());
+        } else {
+            data->assign(t.begin(), t.end());
+        }
+    }
+
     void dispatch_(const MLModelService::tensor_view<std::int8_t>& t) const {
-        target_->mutable_int8_tensor()->mutable_data()->clear();
-        target_->mutable_int8_tensor()->mutable_data()->assign(t.begin(), t.end());
+        copy_bytes_(t, target_->mutable_int8_tensor()->mutable_data());
     }
 
     void dispatch_(const MLModelService::tensor_view<std::uint8_t>& t) const {
-        target_->mutable_uint8_tensor()->mutable_data()->clear();
-        target_->mutable_uint8_tensor()->mutable_data()->assign(t.begin(), t.end());
+        copy_bytes_(t, target_->mutable_uint8_tensor()->mutable_data());
     }
 
     void dispatch_(const MLModelService::tensor_view<std::int16_t>& t) const {
-        // TODO: LE specific. More work is needed here to support BE,
-        // if that is ever relevant. Specifically, on a BE platform
-        // after doing the assignment, each hi/low pair of each uint32
-        // must be swapped.
-        //
-        // Unfortuanate: we need to do the zero filling for all bytes.
-        //
-        // Tricky: The last zero is important if there is an odd
-        // number of shorts.
-        const int num32s =
-            static_cast<int>((t.size() + 1) * sizeof(std::int16_t) / sizeof(std::uint32_t));
-        target_->mutable_int16_tensor()->mutable_data()->Clear();
-
-#if defined(GOOGLE_PROTOBUF_VERSION) && GOOGLE_PROTOBUF_VERSION >= 7035000
-        target_->mutable_int16_tensor()->mutable_data()->resize(num32s, 0);
-#else
-
-        target_->mutable_int16_tensor()->mutable_data()->Resize(num32s, 0);
-#endif
-
-        std::memcpy(target_->mutable_int16_tensor()->mutable_data()->mutable_data(),
-                    t.begin(),
-                    t.size() * sizeof(std::int16_t));
+        pack_16_bit_elements(t, target_->mutable_int16_tensor()->mutable_data());
     }
 
     void dispatch_(const MLModelService::tensor_view<std::uint16_t>& t) const {
-        // TODO: LE specific. See above comment.
-        const int num32s =
-            static_cast<int>((t.size() + 1) * sizeof(std::uint16_t) / sizeof(std::uint32_t));
-        target_->mutable_uint16_tensor()->mutable_data()->Clear();
-
-#if defined(GOOGLE_PROTOBUF_VERSION) && GOOGLE_PROTOBUF_VERSION >= 7035000
-        target_->mutable_uint16_tensor()->mutable_data()->resize(num32s, 0);
-#else
-
-        target_->mutable_uint16_tensor()->mutable_data()->Resize(num32s, 0);
-#endif
-
-        std::memcpy(target_->mutable_uint16_tensor()->mutable_data()->mutable_data(),
-                    t.begin(),
-                    t.size() * sizeof(std::uint16_t));
+        pack_16_bit_elements(t, target_->mutable_uint16_tensor()->mutable_data());
     }
 
     void dispatch_(const MLModelService::tensor_view<std::int32_t>& t) const {
-        target_->mutable_int32_tensor()->mutable_data()->Clear();
-        target_->mutable_int32_tensor()->mutable_data()->Add(t.begin(), t.end());
+        copy_elements(t, target_->mutable_int32_tensor()->mutable_data());
     }
 
     void dispatch_(const MLModelService::tensor_view<std::uint32_t>& t) const {
-        target_->mutable_uint32_tensor()->mutable_data()->Clear();
-        target_->mutable_uint32_tensor()->mutable_data()->Add(t.begin(), t.end());
+        copy_elements(t, target_->mutable_uint32_tensor()->mutable_data());
     }
 
     void dispatch_(const MLModelService::tensor_view<std::int64_t>& t) const {
-        target_->mutable_int64_tensor()->mutable_data()->Clear();
-        target_->mutable_int64_tensor()->mutable_data()->Add(t.begin(), t.end());
+        copy_elements(t, target_->mutable_int64_tensor()->mutable_data());
     }
 
     void dispatch_(const MLModelService::tensor_view<std::uint64_t>& t) const {
-        target_->mutable_uint64_tensor()->mutable_data()->Clear();
-        target_->mutable_uint64_tensor()->mutable_data()->Add(t.begin(), t.end());
+        copy_elements(t, target_->mutable_uint64_tensor()->mutable_data());
     }
 
     void dispatch_(const MLModelService::tensor_view<float>& t) const {
-        target_->mutable_float_tensor()->mutable_data()->Clear();
-        target_->mutable_float_tensor()->mutable_data()->Add(t.begin(), t.end());
+        copy_elements(t, target_->mutable_float_tensor()->mutable_data());
     }
 
     void dispatch_(const MLModelService::tensor_view<double>& t) const {
-        target_->mutable_double_tensor()->mutable_data()->Clear();
-        target_->mutable_double_tensor()->mutable_data()->Add(t.begin(), t.end());
+        copy_elements(t, target_->mutable_double_tensor()->mutable_data());
     }
 
     ::viam::service::mlmodel::v1::FlatTensor* target_;
 };
 
+// Recently released tensor buffers, for each data type. Buffers are kept in size classes: a
+// buffer in class `c` has room for at least 2^c elements, so any buffer taken from the class
+// for a tensor can hold it. Each thread caches a few buffers of each class, in front of a
+// shared depot for buffers released on one thread and acquired on another.
+template <typename T>
+class tensor_buffer_pool {
+   public:
+    static std::shared_ptr<std::vector<T>> acquire(std::size_t size) {
+        const std::size_t size_class = size_class_of_(size);
+        if ((std::size_t{1} << size_class) > k_max_pooled_bytes / sizeof(T)) {
+            auto buffer = std::make_shared<std::vector<T>>();
+            buffer->reserve(size);
+            return buffer;
+        }
+
+        std::unique_ptr<std::vector<T>> buffer = take_(size_class);
+        if (!buffer) {
+            buffer = std::make_unique<std::vector<T>>();
+            buffer->reserve(std::size_t{1} << size_class);
+        }
+        return {buffer.release(), [size_class](std::vector<T>* released) {
+                    give_(size_class, std::unique_ptr<std::vector<T>>(released));
+                }};
+    }
+
+   private:
+    // Larger buffers are allocated for each tensor and freed with it, to bound how much memory
+    // the pool holds.
+    static constexpr std::size_t k_max_pooled_bytes = std::size_t{64} << 20;
+    static constexpr std::size_t k_thread_cached_per_class = 2;
+    static constexpr std::size_t k_shared_per_class = 8;
+
+    using buffer_list = std::vector<std::unique_ptr<std::vector<T>>>;
+    using free_lists = std::array<buffer_list, std::numeric_limits<std::size_t>::digits>;
+
+    struct shared_depot {
+        std::mutex lock;
+        free_lists lists;
+    };
+
+    // Hands its buffers to the shared depot when its thread exits.
+    struct thread_cache {
+        explicit thread_cache(bool* destroyed) : destroyed(destroyed) {}
+
+        ~thread_cache() {
+            *destroyed = true;
+            for (std::size_t size_class = 0; size_class < lists.size(); ++size_class) {
+                for (auto& buffer : lists[size_class]) {
+                    give_shared_(size_class, std::move(buffer));
+                }
+            }
+        }
+
+        bool* destroyed;
+        free_lists lists;
+    };
+
+    static std::size_t size_class_of_(std::size_t size) {
+        std::size_t size_class = 0;
+        while ((std::size_t{1} << size_class) < size) {
+            ++size_class;
+        }
+        return size_class;
+    }
+
+    // Returns null once the calling thread has begun destroying its thread locals.
+    static free_lists* local_() {
+        // Trivially destructible, so it can still be read while the thread exits.
+        static thread_local bool destroyed = false;
+        if (destroyed) {
+            return nullptr;
+        }
+        static thread_local thread_cache cache{&destroyed};
+        return &cache.lists;
+    }
+
+    static shared_depot& shared_() {
+        // Never destroyed, so that buffers released during static destruction can still be
+        // given back.
+        static auto* const depot = new shared_depot;
+        return *depot;
+    }
+
+    static std::unique_ptr<std::vector<T>> pop_(buffer_list& list) {
+        std::unique_ptr<std::vector<T>> buffer = std::move(list.back());
+        list.pop_back();
+        return buffer;
+    }
+
+    static std::unique_ptr<std::vector<T>> take_(std::size_t size_class) {
+        if (free_lists* local = local_()) {
+            auto& list = (*local)[size_class];
+            if (!list.empty()) {
+                return pop_(list);
+            }
+        }
+        auto& depot = shared_();
+        const std::lock_guard<std::mutex> guard(depot.lock);
+        auto& list = depot.lists[size_class];
+        if (!list.empty()) {
+            return pop_(list);
+        }
+        return nullptr;
+    }
+
+    static void give_(std::size_t size_class, std::unique_ptr<std::vector<T>> buffer) {
+        buffer->clear();
+        if (free_lists* local = local_()) {
+            auto& list = (*local)[size_class];
+            if (list.size() < k_thread_cached_per_class) {
+                list.push_back(std::move(buffer));
+                return;
+            }
+        }
+        give_shared_(size_class, std::move(buffer));
+    }
+
+    static void give_shared_(std::size_t size_class, std::unique_ptr<std::vector<T>> buffer) {
+        auto& depot = shared_();
+        const std::lock_guard<std::mutex> guard(depot.lock);
+        auto& list = depot.lists[size_class];
+        if (list.size() < k_shared_per_class) {
+            list.push_back(std::move(buffer));
+        }
+    }
+};
+
 template <typename T>
 MLModelService::tensor_views make_sdk_tensor_from_api_tensor_t(const T* data,
                                                                std::size_t size,
@@ -143,11 +296,10 @@ MLModelService::tensor_views make_sdk_tensor_from_api_tensor_t(const T* data,
     }
 
     if (ts) {
-        auto& storage_variant = *ts->emplace(ts->end(), std::vector<T>{});
-        auto& storage = boost::get<std::vector<T>>(storage_variant);
-        storage.reserve(size);
-        storage.assign(data, data + size);
-        data = storage.data();
+        auto buffer = tensor_buffer_pool<T>::acquire(size);
+        buffer->assign(data, data + size);
+        data = buffer->data();
+        ts->emplace_back(std::move(buffer));
     }
 
     // Figure out how many elements we ought to have per the provided
@@ -193,6 +345,34 @@ MLModelService::tensor_views make_sdk_tensor_from_api_tensor_t(const T* data,
     return MLModelService::make_tensor_view(data, size, std::move(shape));
 }
 
+// Makes a tensor from 16-bit elements packed two to a word, the first in the low half. On little
+// endian hosts that is the native layout, so the tensor can view the words directly. Elsewhere the
+// elements must be unpacked, which requires tensor storage to hold them.
+template <typename T>
+MLModelService::tensor_views make_sdk_tensor_from_api_16_bit_tensor(
+    const ::google::protobuf::RepeatedField<std::uint32_t>& words,
+    std::vector<std::size_t>&& shape,
+    tensor_storage* ts) {
+    const std::size_t size = std::size_t{2} * static_cast<std::size_t>(words.size());
+    if (is_little_endian()) {
+        return make_sdk_tensor_from_api_tensor_t(
+            reinterpret_cast<const T*>(words.data()), size, std::move(shape), ts);
+    }
+
+    if (!ts) {
+        throw Exception(ErrorCondition::k_not_supported,
+                        "Tensor storage is required for 16-bit tensors on big endian hosts");
+    }
+    auto buffer = tensor_buffer_pool<T>::acquire(size);
+    for (const std::uint32_t word : words) {
+        buffer->push_back(static_cast<T>(word & 0xFFFF));
+        buffer->push_back(static_cast<T>(word >> 16));
+    }
+    const T* data = buffer->data();
+    ts->emplace_back(std::move(buffer));
+    return make_sdk_tensor_from_api_tensor_t(data, size, std::move(shape), nullptr);
+}
+
 }  // namespace
 
 void copy_sdk_tensor_to_api_tensor(const MLModelService::tensor_views& source,
@@ -217,19 +397,11 @@ MLModelService::tensor_views make_sdk_tensor_from_api_tensor(
             std::move(shape),
             storage);
     } else if (api_tensor.has_int16_tensor()) {
-        // TODO: be deswizzle
-        return make_sdk_tensor_from_api_tensor_t(
-            reinterpret_cast<const std::int16_t*>(api_tensor.int16_tensor().data().data()),
-            std::size_t{2} * api_tensor.int16_tensor().data().size(),
-            std::move(shape),
-            storage);
+        return make_sdk_tensor_from_api_16_bit_tensor<std::int16_t>(
+            api_tensor.int16_tensor().data(), std::move(shape), storage);
     } else if (api_tensor.has_uint16_tensor()) {
-        // TODO: be deswizzle
-        return make_sdk_tensor_from_api_tensor_t(
-            reinterpret_cast<const std::uint16_t*>(api_tensor.uint16_tensor().data().data()),
-            std::size_t{2} * api_tensor.uint16_tensor().data().size(),
-            std::move(shape),
-            storage);
+        return make_sdk_tensor_from_api_16_bit_tensor<std::uint16_t>(
+            api_tensor.uint16_tensor().data(), std::move(shape), storage);
     } else if (api_tensor.has_int32_tensor()) {
         return make_sdk_tensor_from_api_tensor_t(api_tensor.int32_tensor().data().data(),
                                                  api_tensor.int32_tensor().data().size(),
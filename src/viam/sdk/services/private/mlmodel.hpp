@@ -14,6 +14,7 @@
 
 #pragma once
 
+#include <memory>
 #include <vector>
 
 #include <viam/api/service/mlmodel/v1/mlmodel.grpc.pb.h>
@@ -25,8 +26,12 @@ namespace sdk {
 namespace impl {
 namespace mlmodel {
 
-using tensor_storage_types = boost::mpl::transform_view<MLModelService::base_types,
-                                                        std::vector<boost::mpl::placeholders::_1>>;
+// The buffers in a `tensor_storage` are drawn from a pool kept for each data type. When the
+// last reference to a buffer is released it goes back to the pool, rather than being freed, so
+// that it can hold the next tensor of a similar size without allocating.
+using tensor_storage_types =
+    boost::mpl::transform_view<MLModelService::base_types,
+                               std::shared_ptr<std::vector<boost::mpl::placeholders::_1>>>;
 
 using tensor_storage = std::vector<boost::make_variant_over<tensor_storage_types>::type>;
 
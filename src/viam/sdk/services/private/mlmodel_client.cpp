@@ -14,9 +14,11 @@
 
 #include <viam/sdk/services/private/mlmodel_client.hpp>
 
+#include <boost/optional/optional.hpp>
 #include <grpcpp/channel.h>
 
 #include <viam/sdk/common/client_helper.hpp>
+#include <viam/sdk/log/logging.hpp>
 #include <viam/sdk/services/private/mlmodel.hpp>
 
 #include <viam/sdk/common/exception.hpp>
@@ -38,7 +40,8 @@ namespace impl {
 MLModelServiceClient::MLModelServiceClient(std::string name, const ViamChannel& channel)
     : MLModelService(std::move(name)),
       stub_(service_type::NewStub(channel.channel())),
-      channel_(&channel) {}
+      channel_(&channel),
+      shared_memory_min_bytes_(mlmodel::shared_memory_min_bytes()) {}
 
 std::shared_ptr<MLModelService::named_tensor_views> MLModelServiceClient::infer(
     const named_tensor_views& inputs, const ProtoStruct& extra) {
@@ -63,13 +66,59 @@ std::shared_ptr<MLModelService::named_tensor_views> MLModelServiceClient::infer(
     auto aav = std::make_shared<arena_and_views>();
     aav->arena = std::move(arena);
 
+    // Send large inputs through shared memory if it is enabled, available, and the server has
+    // said that it accepts them.
+    std::unique_ptr<mlmodel::SharedMemorySegment> segment;
+    boost::optional<mlmodel::SharedMemoryInputs> shared_inputs;
+    if (shared_memory_min_bytes_ != 0 && shared_memory_.enabled() && shared_memory_.accepted()) {
+        shared_inputs.emplace(inputs, shared_memory_min_bytes_);
+        if (!shared_inputs->empty()) {
+            segment = shared_memory_.acquire(shared_inputs->bytes());
+        }
+        if (segment) {
+            shared_inputs->write(*segment, req->mutable_extra());
+        } else {
+            shared_inputs = boost::none;
+        }
+    }
+
     auto& input_tensors = *req->mutable_input_tensors()->mutable_tensors();
     for (const auto& kv : inputs) {
+        if (shared_inputs && shared_inputs->contains(kv.first)) {
+            continue;
+        }
         auto& emplaced = input_tensors[kv.first];
         mlmodel::copy_sdk_tensor_to_api_tensor(kv.second, &emplaced);
     }
 
-    const auto result = stub_->Infer(ctx, *req, resp);
+    auto result = stub_->Infer(ctx, *req, resp);
+    if (shared_memory_min_bytes_ != 0 && !shared_memory_.accepted() &&
+        mlmodel::server_accepts_shared_memory(*static_cast<GrpcClientContext*>(ctx))) {
+        shared_memory_.accept();
+    }
+    if (segment) {
+        const std::string& message = result.error_message();
+        if (result.error_code() == ::grpc::FAILED_PRECONDITION &&
+            message.compare(0,
+                            sizeof(mlmodel::k_shared_memory_unavailable) - 1,
+                            mlmodel::k_shared_memory_unavailable) == 0) {
+            VIAM_SDK_LOG(warn) << "MLModel inputs will be sent as protobuf: " << message;
+            shared_memory_.disable();
+
+            req->mutable_extra()->mutable_fields()->erase(mlmodel::k_shared_memory_key);
+            for (const auto& kv : inputs) {
+                if (shared_inputs->contains(kv.first)) {
+                    mlmodel::copy_sdk_tensor_to_api_tensor(kv.second, &input_tensors[kv.first]);
+                }
+            }
+            ClientContext retry_ctx;
+            result = stub_->Infer(retry_ctx, *req, resp);
+        } else if (result.ok()) {
+            // The server is done with the segment. After a failure it may still be reading it,
+            // so the segment is dropped instead.
+            shared_memory_.release(std::move(segment));
+        }
+    }
     if (!result.ok()) {
         throw GRPCException(&result);
     }
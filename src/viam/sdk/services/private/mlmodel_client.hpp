@@ -18,6 +18,7 @@
 
 #include <viam/sdk/rpc/dial.hpp>
 #include <viam/sdk/services/mlmodel.hpp>
+#include <viam/sdk/services/private/mlmodel_shared_memory.hpp>
 
 namespace viam {
 namespace sdk {
@@ -59,6 +60,10 @@ class MLModelServiceClient : public MLModelService {
    private:
     std::unique_ptr<service_type::StubInterface> stub_;
     const ViamChannel* channel_;
+
+    // The size from which inputs go through shared memory, or zero if they never do.
+    const std::size_t shared_memory_min_bytes_;
+    mlmodel::SharedMemorySegmentPool shared_memory_;
 };
 
 }  // namespace impl
@@ -14,10 +14,16 @@
 
 #include <viam/sdk/services/private/mlmodel_server.hpp>
 
+#include <algorithm>
+#include <iterator>
+
+#include <boost/optional/optional.hpp>
+
 #include <viam/sdk/common/private/service_helper.hpp>
 #include <viam/sdk/rpc/server.hpp>
 #include <viam/sdk/services/mlmodel.hpp>
 #include <viam/sdk/services/private/mlmodel.hpp>
+#include <viam/sdk/services/private/mlmodel_shared_memory.hpp>
 
 namespace viam {
 namespace sdk {
@@ -32,19 +38,36 @@ MLModelServiceServer::MLModelServiceServer(std::shared_ptr<ResourceManager> mana
     ::viam::service::mlmodel::v1::InferResponse* response) noexcept {
     return make_service_helper<MLModelService>(
         "MLModelServiceServer::Infer", this, context, request)([&](auto& helper, auto& mlms) {
+        mlmodel::advertise_shared_memory(context);
         if (!request->has_input_tensors()) {
             return helper.fail(::grpc::INVALID_ARGUMENT, "Called with no input tensors");
         }
 
-        const auto md = mlms->metadata({});
+        // Inputs which a client on this host sent through shared memory, mapped until the
+        // response has been built.
+        std::unique_ptr<mlmodel::MappedSharedMemoryInputs> shared_inputs;
+        if (request->has_extra()) {
+            const auto& fields = request->extra().fields();
+            const auto where = fields.find(mlmodel::k_shared_memory_key);
+            if (where != fields.end()) {
+                try {
+                    shared_inputs =
+                        std::make_unique<mlmodel::MappedSharedMemoryInputs>(where->second);
+                } catch (const std::exception& e) {
+                    const std::string message = mlmodel::k_shared_memory_unavailable +
+                                                std::string(e.what());
+                    return helper.fail(::grpc::FAILED_PRECONDITION, message.c_str());
+                }
+            }
+        }
+
+        const auto& tensors = request->input_tensors().tensors();
+        const std::size_t num_tensors =
+            tensors.size() + (shared_inputs ? shared_inputs->views().size() : 0);
         MLModelService::named_tensor_views inputs;
 
-        // Check if there's only one input tensor and metadata only expects one, too
-        if (request->input_tensors().tensors().size() == 1 && md.inputs.size() == 1) {
-            // Special case: just one tensor, add it without name check
-            const MLModelService::tensor_info input = md.inputs[0];
-            const auto& tensor_pair = *request->input_tensors().tensors().begin();
-            auto tensor = mlmodel::make_sdk_tensor_from_api_tensor(tensor_pair.second);
+        const auto bind = [&](const input_binding::input& input,
+                              MLModelService::tensor_views tensor) {
             const auto tensor_type = MLModelService::tensor_info::tensor_views_to_data_type(tensor);
             if (tensor_type != input.data_type) {
                 std::ostringstream message;
@@ -53,13 +76,45 @@ MLModelServiceServer::MLModelServiceServer(std::shared_ptr<ResourceManager> mana
                 return helper.fail(::grpc::INVALID_ARGUMENT, message.str().c_str());
             }
             inputs.emplace(input.name, std::move(tensor));
-        } else {
+            return ::grpc::Status();
+        };
+
+        // Finds the input named `name`, whether it was sent as a `FlatTensor` or through shared
+        // memory.
+        const auto find =
+            [&](const std::string& name) -> boost::optional<MLModelService::tensor_views> {
+            const auto where = tensors.find(name);
+            if (where != tensors.end()) {
+                return mlmodel::make_sdk_tensor_from_api_tensor(where->second);
+            }
+            if (shared_inputs) {
+                const auto shared = shared_inputs->views().find(name);
+                if (shared != shared_inputs->views().end()) {
+                    return shared->second;
+                }
+            }
+            return boost::none;
+        };
+
+        const auto bind_all = [&](const input_binding& binding) {
+            inputs.clear();
+
+            // Check if there's only one input tensor and metadata only expects one, too
+            if (num_tensors == 1 && binding.inputs.size() == 1) {
+                // Special case: just one tensor, add it without name check
+                return bind(
+                    binding.inputs[0],
+                    tensors.empty()
+                        ? shared_inputs->views().begin()->second
+                        : mlmodel::make_sdk_tensor_from_api_tensor(tensors.begin()->second));
+            }
+
             // Normal case: multiple tensors, do metadata checks
             // If there are extra tensors in the inputs that not found in the metadata,
             // they will not be passed on to the implementation.
-            for (const auto& input : md.inputs) {
-                const auto where = request->input_tensors().tensors().find(input.name);
-                if (where == request->input_tensors().tensors().end()) {
+            for (const auto& input : binding.inputs) {
+                auto tensor = find(input.name);
+                if (!tensor) {
                     // if the input vector of the expected name is not found, return an error
                     std::ostringstream message;
                     message << "Expected tensor input `" << input.name
@@ -67,21 +122,32 @@ MLModelServiceServer::MLModelServiceServer(std::shared_ptr<ResourceManager> mana
                                "different name, rename it to the expected tensor name";
                     return helper.fail(::grpc::INVALID_ARGUMENT, message.str().c_str());
                 }
-                auto tensor = mlmodel::make_sdk_tensor_from_api_tensor(where->second);
-                const auto tensor_type =
-                    MLModelService::tensor_info::tensor_views_to_data_type(tensor);
-                if (tensor_type != input.data_type) {
-                    std::ostringstream message;
-                    message << "Tensor input `" << input.name
-                            << "` was the wrong type; expected type " << input.data_type
-                            << " but got type " << tensor_type;
-                    return helper.fail(::grpc::INVALID_ARGUMENT, message.str().c_str());
+                const auto status = bind(input, std::move(*tensor));
+                if (!status.ok()) {
+                    return status;
                 }
-                inputs.emplace(std::move(input.name), std::move(tensor));
+            }
+            return ::grpc::Status();
+        };
+
+        const auto binding = input_binding_for_(request->name(), mlms);
+        auto status = bind_all(*binding);
+        if (!status.ok()) {
+            // A service which changed its inputs in place, without calling `metadata_changed`,
+            // would otherwise have its requests checked against the metadata it had before.
+            // Check the request against the current metadata before rejecting it.
+            const auto current = input_binding_for_(request->name(), mlms, true);
+            if (!same_inputs_(*binding, *current)) {
+                status = bind_all(*current);
+            }
+            if (!status.ok()) {
+                return status;
             }
         }
 
-        const auto outputs = mlms->infer(inputs, helper.getExtra());
+        ProtoStruct extra = helper.getExtra();
+        extra.erase(mlmodel::k_shared_memory_key);
+        const auto outputs = mlms->infer(inputs, extra);
 
         auto* const output_tensors = response->mutable_output_tensors()->mutable_tensors();
         for (const auto& kv : *outputs) {
@@ -183,6 +249,63 @@ MLModelServiceServer::MLModelServiceServer(std::shared_ptr<ResourceManager> mana
     });
 }
 
+bool MLModelServiceServer::same_inputs_(const input_binding& a, const input_binding& b) {
+    return std::equal(a.inputs.begin(),
+                      a.inputs.end(),
+                      b.inputs.begin(),
+                      b.inputs.end(),
+                      [](const input_binding::input& x, const input_binding::input& y) {
+                          return x.name == y.name && x.data_type == y.data_type;
+                      });
+}
+
+std::shared_ptr<const MLModelServiceServer::input_binding>
+MLModelServiceServer::input_binding_for_(const std::string& name,
+                                         const std::shared_ptr<MLModelService>& mlms,
+                                         bool refresh) {
+    const auto generation = mlms->metadata_generation();
+    if (!refresh) {
+        const std::lock_guard<std::mutex> lock(bindings_lock_);
+        const auto where = bindings_.find(name);
+        if (where != bindings_.end()) {
+            const auto& cached = where->second;
+            // Compare control blocks rather than addresses, so that a new service allocated where
+            // an expired one used to live is not mistaken for it.
+            const bool same_service =
+                !cached->service.owner_before(mlms) && !mlms.owner_before(cached->service);
+            if (same_service && cached->generation == generation) {
+                return cached;
+            }
+            if (cached->service.expired()) {
+                bindings_.erase(where);
+            }
+        }
+    }
+
+    // Fetch the metadata without holding the lock, since the service may take its time. If two
+    // requests race to rebuild the binding, both results are equivalent and the last one wins.
+    auto md = mlms->metadata({});
+
+    auto binding = std::make_shared<input_binding>();
+    binding->service = mlms;
+    binding->generation = generation;
+    binding->inputs.reserve(md.inputs.size());
+    for (auto& input : md.inputs) {
+        binding->inputs.push_back({std::move(input.name), input.data_type});
+    }
+
+    const std::lock_guard<std::mutex> lock(bindings_lock_);
+    bindings_[name] = binding;
+
+    // The manager doesn't tell us when it drops a service, and the `weak_ptr` in a binding keeps
+    // the allocation of its service alive. Drop the bindings of removed services whenever a
+    // binding is compiled, which is rare, so that they don't pile up.
+    for (auto it = bindings_.begin(); it != bindings_.end();) {
+        it = it->second->service.expired() ? bindings_.erase(it) : std::next(it);
+    }
+    return binding;
+}
+
 }  // namespace impl
 }  // namespace sdk
 }  // namespace viam
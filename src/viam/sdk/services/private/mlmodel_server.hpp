@@ -14,6 +14,13 @@
 
 #pragma once
 
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
 #include <viam/api/common/v1/common.grpc.pb.h>
 #include <viam/api/service/mlmodel/v1/mlmodel.grpc.pb.h>
 
@@ -48,6 +55,34 @@ class MLModelServiceServer : public ResourceServer,
     ::grpc::Status GetStatus(::grpc::ServerContext* context,
                              const ::viam::common::v1::GetStatusRequest* request,
                              ::viam::common::v1::GetStatusResponse* response) noexcept override;
+
+   private:
+    // The parts of a served model's metadata which `Infer` needs in order to validate and bind
+    // request tensors, extracted once rather than on every call.
+    struct input_binding {
+        struct input {
+            std::string name;
+            MLModelService::tensor_info::data_types data_type;
+        };
+
+        // The service and metadata generation this binding was compiled from. A module replaces
+        // the service instance when the resource is reconfigured, which invalidates the binding;
+        // services which change their metadata in place call `metadata_changed` instead.
+        std::weak_ptr<MLModelService> service;
+        std::uint64_t generation;
+
+        std::vector<input> inputs;
+    };
+
+    static bool same_inputs_(const input_binding& a, const input_binding& b);
+
+    // Returns the cached binding for `mlms`, or compiles one from its metadata if there is none
+    // yet, it is stale, or `refresh` is set.
+    std::shared_ptr<const input_binding> input_binding_for_(
+        const std::string& name, const std::shared_ptr<MLModelService>& mlms, bool refresh = false);
+
+    std::mutex bindings_lock_;
+    std::unordered_map<std::string, std::shared_ptr<const input_binding>> bindings_;
 };
 
 }  // namespace impl
@@ -0,0 +1,405 @@
+#include <viam/sdk/services/private/mlmodel_shared_memory.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <sstream>
+#include <type_traits>
+#include <utility>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define VIAMCPPSDK_MLMODEL_SHARED_MEMORY
+#endif
+
+#include <boost/variant/apply_visitor.hpp>
+#include <boost/variant/static_visitor.hpp>
+#include <grpcpp/client_context.h>
+#include <grpcpp/server_context.h>
+
+#include <viam/sdk/common/exception.hpp>
+#include <viam/sdk/common/utils.hpp>
+#include <viam/sdk/log/logging.hpp>
+
+namespace viam {
+namespace sdk {
+namespace impl {
+namespace mlmodel {
+
+namespace {
+
+constexpr char k_segment_prefix[] = "/viam-mlmodel-";
+
+// Each input starts on a cache line, which also satisfies the alignment of every element type.
+constexpr std::size_t k_input_alignment = 64;
+
+// Segments are sized in powers of two from here, so that a segment can be reused for calls
+// whose inputs vary a little in size.
+constexpr std::size_t k_min_segment_size = std::size_t{64} << 10;
+
+// How many idle segments a client keeps for concurrent calls.
+constexpr std::size_t k_max_idle_segments = 4;
+
+std::size_t align_up(std::size_t offset, std::size_t alignment) {
+    return (offset + alignment - 1) / alignment * alignment;
+}
+
+class tensor_bytes_visitor : public boost::static_visitor<std::size_t> {
+   public:
+    template <typename View>
+    std::size_t operator()(const View& t) const {
+        return t.size() * sizeof(typename View::value_type);
+    }
+};
+
+class tensor_shape_visitor : public boost::static_visitor<std::vector<std::size_t>> {
+   public:
+    template <typename View>
+    std::vector<std::size_t> operator()(const View& t) const {
+        return {t.shape().begin(), t.shape().end()};
+    }
+};
+
+class copy_tensor_visitor : public boost::static_visitor<void> {
+   public:
+    explicit copy_tensor_visitor(unsigned char* target) : target_(target) {}
+
+    template <typename View>
+    void operator()(const View& t) const {
+        using T = std::remove_const_t<typename View::value_type>;
+        if (t.layout() == xt::layout_type::row_major) {
+            std::memcpy(target_, t.data(), t.size() * sizeof(T));
+        } else {
+            std::copy(t.begin(), t.end(), reinterpret_cast<T*>(target_));
+        }
+    }
+
+   private:
+    unsigned char* target_;
+};
+
+std::size_t element_size(MLModelService::tensor_info::data_types data_type) {
+    using data_types = MLModelService::tensor_info::data_types;
+    switch (data_type) {
+        case data_types::k_int8:
+        case data_types::k_uint8:
+            return 1;
+        case data_types::k_int16:
+        case data_types::k_uint16:
+            return 2;
+        case data_types::k_int32:
+        case data_types::k_uint32:
+        case data_types::k_float32:
+            return 4;
+        case data_types::k_int64:
+        case data_types::k_uint64:
+        case data_types::k_float64:
+            return 8;
+    }
+    throw Exception("Unknown tensor data type");
+}
+
+template <typename T>
+MLModelService::tensor_views view_as(const unsigned char* data,
+                                     std::size_t count,
+                                     std::vector<std::size_t> shape) {
+    return MLModelService::make_tensor_view(
+        reinterpret_cast<const T*>(data), count, std::move(shape));
+}
+
+MLModelService::tensor_views make_view(MLModelService::tensor_info::data_types data_type,
+                                       const unsigned char* data,
+                                       std::size_t count,
+                                       std::vector<std::size_t> shape) {
+    using data_types = MLModelService::tensor_info::data_types;
+    switch (data_type) {
+        case data_types::k_int8:
+            return view_as<std::int8_t>(data, count, std::move(shape));
+        case data_types::k_uint8:
+            return view_as<std::uint8_t>(data, count, std::move(shape));
+        case data_types::k_int16:
+            return view_as<std::int16_t>(data, count, std::move(shape));
+        case data_types::k_uint16:
+            return view_as<std::uint16_t>(data, count, std::move(shape));
+        case data_types::k_int32:
+            return view_as<std::int32_t>(data, count, std::move(shape));
+        case data_types::k_uint32:
+            return view_as<std::uint32_t>(data, count, std::move(shape));
+        case data_types::k_int64:
+            return view_as<std::int64_t>(data, count, std::move(shape));
+        case data_types::k_uint64:
+            return view_as<std::uint64_t>(data, count, std::move(shape));
+        case data_types::k_float32:
+            return view_as<float>(data, count, std::move(shape));
+        case data_types::k_float64:
+            return view_as<double>(data, count, std::move(shape));
+    }
+    throw Exception("Unknown tensor data type");
+}
+
+const ::google::protobuf::Value& field(const ::google::protobuf::Struct& s, const char* name) {
+    const auto where = s.fields().find(name);
+    if (where == s.fields().end()) {
+        std::ostringstream message;
+        message << "Shared memory tensor description has no `" << name << "`";
+        throw Exception(message.str());
+    }
+    return where->second;
+}
+
+std::size_t to_size(const ::google::protobuf::Value& value, const char* what) {
+    // Doubles represent every integer up to 2^53 exactly.
+    constexpr double k_max_exact = 9007199254740992.0;
+    const double number = value.number_value();
+    if (value.kind_case() != ::google::protobuf::Value::kNumberValue || !(number >= 0) ||
+        number > k_max_exact || std::floor(number) != number) {
+        std::ostringstream message;
+        message << "Shared memory tensor description has an invalid " << what;
+        throw Exception(message.str());
+    }
+    return static_cast<std::size_t>(number);
+}
+
+}  // namespace
+
+void advertise_shared_memory(GrpcServerContext* context) {
+#ifdef VIAMCPPSDK_MLMODEL_SHARED_MEMORY
+    context->AddInitialMetadata(k_shared_memory_header, "1");
+#else
+    (void)context;
+#endif
+}
+
+bool server_accepts_shared_memory(const GrpcClientContext& context) {
+    const auto& headers = context.GetServerInitialMetadata();
+    return headers.find(k_shared_memory_header) != headers.end();
+}
+
+std::size_t shared_memory_min_bytes() {
+    const char* const var = "VIAM_MLMODEL_SHARED_MEMORY_MIN_BYTES";
+    const auto value = get_env(var);
+    if (!value) {
+        return 0;
+    }
+    char* end = nullptr;
+    const unsigned long long parsed = std::strtoull(value->c_str(), &end, 10);
+    if (value->empty() || *end != '\0' || value->front() == '-') {
+        VIAM_SDK_LOG(warn) << "Ignoring invalid value `" << *value << "` for " << var;
+        return 0;
+    }
+    return static_cast<std::size_t>(parsed);
+}
+
+SharedMemorySegment::SharedMemorySegment(std::string name, unsigned char* data, std::size_t size)
+    : name_(std::move(name)), data_(data), size_(size) {}
+
+std::unique_ptr<SharedMemorySegment> SharedMemorySegment::create(std::size_t size) {
+#ifdef VIAMCPPSDK_MLMODEL_SHARED_MEMORY
+    static std::atomic<std::uint64_t> next_id{0};
+    std::string name = k_segment_prefix + std::to_string(::getpid()) + "-" +
+                       std::to_string(next_id.fetch_add(1, std::memory_order_relaxed));
+
+    const int fd = ::shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, S_IRUSR | S_IWUSR);
+    if (fd < 0) {
+        VIAM_SDK_LOG(debug) << "Cannot create shared memory segment " << name << ": "
+                            << std::strerror(errno);
+        return nullptr;
+    }
+
+    void* data = MAP_FAILED;
+    if (::ftruncate(fd, static_cast<off_t>(size)) == 0) {
+        data = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    }
+    const int error = errno;
+    ::close(fd);
+    if (data == MAP_FAILED) {
+        ::shm_unlink(name.c_str());
+        VIAM_SDK_LOG(debug) << "Cannot map shared memory segment " << name << ": "
+                            << std::strerror(error);
+        return nullptr;
+    }
+
+    return std::unique_ptr<SharedMemorySegment>(
+        new SharedMemorySegment(std::move(name), static_cast<unsigned char*>(data), size));
+#else
+    (void)size;
+    return nullptr;
+#endif
+}
+
+SharedMemorySegment::~SharedMemorySegment() {
+#ifdef VIAMCPPSDK_MLMODEL_SHARED_MEMORY
+    ::munmap(data_, size_);
+    ::shm_unlink(name_.c_str());
+#endif
+}
+
+std::unique_ptr<SharedMemorySegment> SharedMemorySegmentPool::acquire(std::size_t size) {
+    {
+        const std::lock_guard<std::mutex> guard(lock_);
+        const auto where =
+            std::find_if(idle_.begin(), idle_.end(), [size](const auto& segment) {
+                return segment->size() >= size;
+            });
+        if (where != idle_.end()) {
+            auto segment = std::move(*where);
+            idle_.erase(where);
+            return segment;
+        }
+    }
+
+    std::size_t segment_size = k_min_segment_size;
+    while (segment_size < size) {
+        segment_size *= 2;
+    }
+    auto segment = SharedMemorySegment::create(segment_size);
+    if (!segment && enabled()) {
+        VIAM_SDK_LOG(warn) << "Shared memory is unavailable, so MLModel inputs will be sent as "
+                              "protobuf";
+        disable();
+    }
+    return segment;
+}
+
+void SharedMemorySegmentPool::release(std::unique_ptr<SharedMemorySegment> segment) {
+    const std::lock_guard<std::mutex> guard(lock_);
+    if (idle_.size() < k_max_idle_segments) {
+        idle_.push_back(std::move(segment));
+    } else {
+        // Keep the larger segments, which can serve any call the smaller ones could.
+        const auto smallest =
+            std::min_element(idle_.begin(), idle_.end(), [](const auto& a, const auto& b) {
+                return a->size() < b->size();
+            });
+        if ((*smallest)->size() < segment->size()) {
+            std::swap(*smallest, segment);
+        }
+    }
+}
+
+SharedMemoryInputs::SharedMemoryInputs(const MLModelService::named_tensor_views& inputs,
+                                       std::size_t min_bytes) {
+    for (const auto& kv : inputs) {
+        const std::size_t bytes = boost::apply_visitor(tensor_bytes_visitor{}, kv.second);
+        if (bytes == 0 || bytes < min_bytes) {
+            continue;
+        }
+        const std::size_t offset = align_up(bytes_, k_input_alignment);
+        inputs_.push_back({&kv.first, &kv.second, offset});
+        bytes_ = offset + bytes;
+    }
+}
+
+bool SharedMemoryInputs::contains(const std::string& name) const {
+    return std::any_of(
+        inputs_.begin(), inputs_.end(), [&name](const input& i) { return *i.name == name; });
+}
+
+void SharedMemoryInputs::write(const SharedMemorySegment& segment,
+                               ::google::protobuf::Struct* extra) const {
+    auto& description = *(*extra->mutable_fields())[k_shared_memory_key].mutable_struct_value();
+    auto& fields = *description.mutable_fields();
+    fields["segment"].set_string_value(segment.name());
+    auto& tensors = *fields["tensors"].mutable_struct_value()->mutable_fields();
+
+    for (const input& i : inputs_) {
+        boost::apply_visitor(copy_tensor_visitor{segment.data() + i.offset}, *i.tensor);
+
+        auto& tensor = *tensors[*i.name].mutable_struct_value()->mutable_fields();
+        tensor["offset"].set_number_value(static_cast<double>(i.offset));
+        tensor["data_type"].set_string_value(MLModelService::tensor_info::data_type_to_string(
+            MLModelService::tensor_info::tensor_views_to_data_type(*i.tensor)));
+        auto& shape = *tensor["shape"].mutable_list_value()->mutable_values();
+        for (const std::size_t dim : boost::apply_visitor(tensor_shape_visitor{}, *i.tensor)) {
+            shape.Add()->set_number_value(static_cast<double>(dim));
+        }
+    }
+}
+
+MappedSharedMemoryInputs::MappedSharedMemoryInputs(const ::google::protobuf::Value& description) {
+#ifdef VIAMCPPSDK_MLMODEL_SHARED_MEMORY
+    const auto& root = description.struct_value();
+    const std::string& name = field(root, "segment").string_value();
+    // Only map segments made for this purpose, rather than whatever a request names.
+    if (name.compare(0, std::strlen(k_segment_prefix), k_segment_prefix) != 0 ||
+        name.find('/', 1) != std::string::npos) {
+        throw Exception("Invalid shared memory segment name `" + name + "`");
+    }
+
+    const int fd = ::shm_open(name.c_str(), O_RDONLY, 0);
+    if (fd < 0) {
+        throw Exception("Cannot open shared memory segment " + name + ": " + std::strerror(errno));
+    }
+    struct stat info {};
+    void* data = MAP_FAILED;
+    if (::fstat(fd, &info) == 0 && info.st_size > 0) {
+        size_ = static_cast<std::size_t>(info.st_size);
+        data = ::mmap(nullptr, size_, PROT_READ, MAP_SHARED, fd, 0);
+    }
+    const int error = errno;
+    ::close(fd);
+    if (data == MAP_FAILED) {
+        throw Exception("Cannot map shared memory segment " + name + ": " + std::strerror(error));
+    }
+    data_ = static_cast<const unsigned char*>(data);
+
+    try {
+        for (const auto& kv : field(root, "tensors").struct_value().fields()) {
+            const auto& tensor = kv.second.struct_value();
+
+            const auto data_type = MLModelService::tensor_info::string_to_data_type(
+                field(tensor, "data_type").string_value());
+            if (!data_type) {
+                throw Exception("Shared memory tensor `" + kv.first + "` has an unknown data type");
+            }
+            const std::size_t element = element_size(*data_type);
+
+            std::vector<std::size_t> shape;
+            std::size_t count = 1;
+            for (const auto& dim : field(tensor, "shape").list_value().values()) {
+                shape.push_back(to_size(dim, "shape"));
+                if (shape.back() != 0 &&
+                    count > std::numeric_limits<std::size_t>::max() / element / shape.back()) {
+                    throw Exception("Shared memory tensor `" + kv.first + "` is too large");
+                }
+                count *= shape.back();
+            }
+
+            const std::size_t offset = to_size(field(tensor, "offset"), "offset");
+            if (shape.empty() || offset % element != 0 || offset > size_ ||
+                count * element > size_ - offset) {
+                throw Exception("Shared memory tensor `" + kv.first +
+                                "` does not fit in its segment");
+            }
+
+            views_.emplace(kv.first,
+                           make_view(*data_type, data_ + offset, count, std::move(shape)));
+        }
+    } catch (...) {
+        ::munmap(const_cast<unsigned char*>(data_), size_);
+        throw;
+    }
+#else
+    (void)description;
+    throw Exception("Shared memory is not supported on this platform");
+#endif
+}
+
+MappedSharedMemoryInputs::~MappedSharedMemoryInputs() {
+#ifdef VIAMCPPSDK_MLMODEL_SHARED_MEMORY
+    ::munmap(const_cast<unsigned char*>(data_), size_);
+#endif
+}
+
+}  // namespace mlmodel
+}  // namespace impl
+}  // namespace sdk
+}  // namespace viam
@@ -0,0 +1,174 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <google/protobuf/struct.pb.h>
+
+#include <viam/sdk/common/grpc_fwd.hpp>
+#include <viam/sdk/services/mlmodel.hpp>
+
+namespace viam {
+namespace sdk {
+namespace impl {
+namespace mlmodel {
+
+// A transport for the large inputs of `infer` when client and server share a host. The client
+// copies each input of at least `shared_memory_min_bytes()` into a POSIX shared memory segment
+// and describes it under `k_shared_memory_key` in the request's `extra`, instead of sending it
+// as a `FlatTensor`. The server maps the segment and views the inputs where they lie.
+//
+// The description has the form
+//
+//     {"segment": "/viam-mlmodel-...",
+//      "tensors": {"<name>": {"offset": 0, "data_type": "float32", "shape": [1, 224, 224, 3]}}}
+
+constexpr char k_shared_memory_key[] = "viam_shared_memory_tensors";
+
+// Servers which cannot map the segment of a request fail it with FAILED_PRECONDITION and a
+// message starting with this, so that the client can send the request again as protobuf.
+constexpr char k_shared_memory_unavailable[] = "Shared memory tensors are unavailable: ";
+
+// The response header with which a server that can map segments answers every `infer` call.
+// Servers which don't know `k_shared_memory_key`, such as those of other SDKs, would ignore it and
+// miss the inputs it describes, so a client only sends inputs through shared memory once the
+// server has answered a call with this header.
+constexpr char k_shared_memory_header[] = "viam-mlmodel-shared-memory";
+
+// Adds `k_shared_memory_header` to the response of an `infer` call, if this build can map
+// segments.
+void advertise_shared_memory(GrpcServerContext* context);
+
+// Whether the server answered an `infer` call with `k_shared_memory_header`.
+bool server_accepts_shared_memory(const GrpcClientContext& context);
+
+// The size in bytes from which a client sends an input through shared memory, read from
+// `VIAM_MLMODEL_SHARED_MEMORY_MIN_BYTES`. Zero, the default, disables the transport.
+std::size_t shared_memory_min_bytes();
+
+// A shared memory segment which a client creates, writes and eventually unlinks.
+class SharedMemorySegment {
+   public:
+    // Returns null if shared memory is unavailable.
+    static std::unique_ptr<SharedMemorySegment> create(std::size_t size);
+
+    SharedMemorySegment(const SharedMemorySegment&) = delete;
+    SharedMemorySegment& operator=(const SharedMemorySegment&) = delete;
+    ~SharedMemorySegment();
+
+    const std::string& name() const noexcept {
+        return name_;
+    }
+
+    unsigned char* data() const noexcept {
+        return data_;
+    }
+
+    std::size_t size() const noexcept {
+        return size_;
+    }
+
+   private:
+    SharedMemorySegment(std::string name, unsigned char* data, std::size_t size);
+
+    std::string name_;
+    unsigned char* data_;
+    std::size_t size_;
+};
+
+// The segments of one client, reused from call to call so that steady state calls neither
+// create nor map segments.
+class SharedMemorySegmentPool {
+   public:
+    // Whether the client should try shared memory at all. False once shared memory has turned
+    // out to be unavailable, on either side.
+    bool enabled() const noexcept {
+        return enabled_.load(std::memory_order_relaxed);
+    }
+
+    void disable() noexcept {
+        enabled_.store(false, std::memory_order_relaxed);
+    }
+
+    // Whether the server has answered with `k_shared_memory_header`. Until it has, inputs are sent
+    // as protobuf.
+    bool accepted() const noexcept {
+        return accepted_.load(std::memory_order_relaxed);
+    }
+
+    void accept() noexcept {
+        accepted_.store(true, std::memory_order_relaxed);
+    }
+
+    // Returns a segment of at least `size` bytes, or null if none can be created, in which case
+    // the pool disables itself.
+    std::unique_ptr<SharedMemorySegment> acquire(std::size_t size);
+
+    void release(std::unique_ptr<SharedMemorySegment> segment);
+
+   private:
+    std::atomic<bool> enabled_{true};
+    std::atomic<bool> accepted_{false};
+    std::mutex lock_;
+    std::vector<std::unique_ptr<SharedMemorySegment>> idle_;
+};
+
+// The inputs of one `infer` call which are large enough to send through shared memory.
+class SharedMemoryInputs {
+   public:
+    SharedMemoryInputs(const MLModelService::named_tensor_views& inputs, std::size_t min_bytes);
+
+    bool empty() const noexcept {
+        return inputs_.empty();
+    }
+
+    // The size of the segment these inputs need.
+    std::size_t bytes() const noexcept {
+        return bytes_;
+    }
+
+    bool contains(const std::string& name) const;
+
+    // Copies the inputs into `segment` and describes them under `k_shared_memory_key` in
+    // `extra`.
+    void write(const SharedMemorySegment& segment, ::google::protobuf::Struct* extra) const;
+
+   private:
+    struct input {
+        const std::string* name;
+        const MLModelService::tensor_views* tensor;
+        std::size_t offset;
+    };
+
+    std::vector<input> inputs_;
+    std::size_t bytes_ = 0;
+};
+
+// The inputs described under `k_shared_memory_key`, mapped read-only for as long as this lives.
+class MappedSharedMemoryInputs {
+   public:
+    // Throws an `Exception` if the description is malformed or the segment cannot be mapped.
+    explicit MappedSharedMemoryInputs(const ::google::protobuf::Value& description);
+
+    MappedSharedMemoryInputs(const MappedSharedMemoryInputs&) = delete;
+    MappedSharedMemoryInputs& operator=(const MappedSharedMemoryInputs&) = delete;
+    ~MappedSharedMemoryInputs();
+
+    const MLModelService::named_tensor_views& views() const noexcept {
+        return views_;
+    }
+
+   private:
+    const unsigned char* data_ = nullptr;
+    std::size_t size_ = 0;
+    MLModelService::named_tensor_views views_;
+};
+
+}  // namespace mlmodel
+}  // namespace impl
+}  // namespace sdk
+}  // namespace viam
@@ -0,0 +1,509 @@
+#include <viam/sdk/services/tensor_ops.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <condition_variable>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <thread>
+#include <utility>
+
+#include <boost/variant/apply_visitor.hpp>
+#include <boost/variant/static_visitor.hpp>
+
+#include <viam/sdk/common/exception.hpp>
+#include <viam/sdk/rpc/private/executor.hpp>
+
+namespace viam {
+namespace sdk {
+namespace tensor_ops {
+
+namespace {
+
+using shape_t = std::vector<std::size_t>;
+
+// The threads which help callers of the transforms. They are never destroyed, so that
+// transforms can run during static destruction.
+impl::Executor& helpers() {
+    static auto* const executor = new impl::Executor(0);
+    return *executor;
+}
+
+// The progress of one `parallel_for`. It is shared with the helpers, which may only get to it
+// after every chunk has been claimed and the caller has returned.
+struct parallel_for_state {
+    const std::function<void(std::size_t, std::size_t)>* body;
+    std::size_t units;
+    std::size_t chunks;
+    std::atomic<std::size_t> next{0};
+    std::atomic<std::size_t> done{0};
+    std::mutex lock;
+    std::condition_variable cv;
+};
+
+void run_chunks(parallel_for_state& state) {
+    std::size_t chunk;
+    while ((chunk = state.next.fetch_add(1)) < state.chunks) {
+        const auto begin = state.units * chunk / state.chunks;
+        const auto end = state.units * (chunk + 1) / state.chunks;
+        (*state.body)(begin, end);
+        if (state.done.fetch_add(1) + 1 == state.chunks) {
+            const std::lock_guard<std::mutex> lock(state.lock);
+            state.cv.notify_all();
+        }
+    }
+}
+
+// Calls `body` on disjoint ranges which together cover [0, units), each unit being
+// `unit_elements` elements of output. The calling thread works through the ranges as well, so
+// the call completes even while every helper is busy.
+void parallel_for(std::size_t units,
+                  std::size_t unit_elements,
+                  const execution& exec,
+                  const std::function<void(std::size_t, std::size_t)>& body) {
+    std::size_t threads = exec.max_threads;
+    if (threads == 0) {
+        threads = std::max(1U, std::thread::hardware_concurrency());
+    }
+    const auto elements = units * unit_elements;
+    threads = std::min({threads,
+                        units,
+                        elements / std::max<std::size_t>(exec.min_elements_per_thread, 1)});
+
+    if (threads <= 1) {
+        if (units != 0) {
+            body(0, units);
+        }
+        return;
+    }
+
+    auto state = std::make_shared<parallel_for_state>();
+    state->body = &body;
+    state->units = units;
+    state->chunks = threads;
+
+    for (std::size_t i = 1; i < threads; ++i) {
+        helpers().post([state] { run_chunks(*state); });
+    }
+    run_chunks(*state);
+
+    std::unique_lock<std::mutex> lock(state->lock);
+    state->cv.wait(lock, [&] { return state->done.load() == state->chunks; });
+}
+
+[[noreturn]] void fail(const char* transform, const std::string& message) {
+    std::ostringstream buffer;
+    buffer << "tensor_ops::" << transform << ": " << message;
+    throw Exception(buffer.str());
+}
+
+void check_output(const char* transform, std::size_t needed, std::size_t provided) {
+    if (provided < needed) {
+        std::ostringstream buffer;
+        buffer << "the output buffer holds " << provided << " elements but the result needs "
+               << needed;
+        fail(transform, buffer.str());
+    }
+}
+
+// The dimensions of an image of shape [H, W, C] or [N, H, W, C].
+struct image_shape {
+    bool batched;
+    std::size_t n;
+    std::size_t h;
+    std::size_t w;
+    std::size_t c;
+
+    std::size_t size() const noexcept {
+        return n * h * w * c;
+    }
+
+    shape_t with_layout(layout l) const {
+        shape_t shape;
+        if (batched) {
+            shape.push_back(n);
+        }
+        if (l == layout::k_channels_first) {
+            shape.insert(shape.end(), {c, h, w});
+        } else {
+            shape.insert(shape.end(), {h, w, c});
+        }
+        return shape;
+    }
+};
+
+template <typename Shape>
+image_shape get_image_shape(const char* transform, const Shape& shape) {
+    if (shape.size() == 3) {
+        return {false, 1, shape[0], shape[1], shape[2]};
+    }
+    if (shape.size() == 4) {
+        return {true, shape[0], shape[1], shape[2], shape[3]};
+    }
+    std::ostringstream buffer;
+    buffer << "expected an image of shape [H, W, C] or [N, H, W, C] but the input has "
+           << shape.size() << " dimensions";
+    fail(transform, buffer.str());
+}
+
+// The unsigned integer type of each element size, which the layout transforms move elements
+// as.
+template <std::size_t Size>
+struct element;
+template <>
+struct element<1> {
+    using type = std::uint8_t;
+};
+template <>
+struct element<2> {
+    using type = std::uint16_t;
+};
+template <>
+struct element<4> {
+    using type = std::uint32_t;
+};
+template <>
+struct element<8> {
+    using type = std::uint64_t;
+};
+
+template <typename E>
+void transpose_hwc_to_chw(const E* input, E* output, const image_shape& s, const execution& exec) {
+    const auto plane = s.h * s.w;
+    // One unit is one row of one image; each row is read once and scattered across the planes.
+    parallel_for(s.n * s.h, s.w * s.c, exec, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t row = begin; row != end; ++row) {
+            const auto n = row / s.h;
+            const auto y = row % s.h;
+            const E* const source = input + row * s.w * s.c;
+            for (std::size_t c = 0; c != s.c; ++c) {
+                E* const target = output + (n * s.c + c) * plane + y * s.w;
+                for (std::size_t x = 0; x != s.w; ++x) {
+                    target[x] = source[x * s.c + c];
+                }
+            }
+        }
+    });
+}
+
+class hwc_to_chw_visitor : public boost::static_visitor<MLModelService::tensor_views> {
+   public:
+    hwc_to_chw_visitor(void* output, std::size_t output_bytes, const execution& exec)
+        : output_(output), output_bytes_(output_bytes), exec_(exec) {}
+
+    template <typename View>
+    MLModelService::tensor_views operator()(const View& input) const {
+        using T = typename View::value_type;
+        using E = typename element<sizeof(T)>::type;
+
+        const auto s = get_image_shape("hwc_to_chw", input.shape());
+        check_output("hwc_to_chw", s.size(), output_bytes_ / sizeof(T));
+
+        transpose_hwc_to_chw(reinterpret_cast<const E*>(input.data()),
+                             static_cast<E*>(output_),
+                             s,
+                             exec_);
+        return MLModelService::make_tensor_view(
+            static_cast<const T*>(output_), s.size(), s.with_layout(layout::k_channels_first));
+    }
+
+   private:
+    void* output_;
+    std::size_t output_bytes_;
+    const execution& exec_;
+};
+
+// Expands a per-channel parameter, given once or once per channel, to one entry per channel.
+std::vector<float> per_channel(const std::vector<float>& values,
+                               std::size_t channels,
+                               const char* name) {
+    if (values.size() == 1) {
+        return std::vector<float>(channels, values.front());
+    }
+    if (values.size() != channels) {
+        std::ostringstream buffer;
+        buffer << "`" << name << "` has " << values.size() << " entries but the image has "
+               << channels << " channels";
+        fail("normalize", buffer.str());
+    }
+    return values;
+}
+
+template <typename Q>
+void quantize_t(const float* input,
+                Q* output,
+                std::size_t size,
+                const quantization& params,
+                const execution& exec) {
+    if (!(params.scale > 0.0f)) {
+        fail("quantize", "the scale must be positive");
+    }
+
+    const float inverse = 1.0f / params.scale;
+    const auto zero_point = static_cast<float>(params.zero_point);
+    constexpr auto lowest = static_cast<float>(std::numeric_limits<Q>::lowest());
+    constexpr auto highest = static_cast<float>(std::numeric_limits<Q>::max());
+
+    parallel_for(size, 1, exec, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i != end; ++i) {
+            float v = std::nearbyint(input[i] * inverse) + zero_point;
+            // Written so that NaN saturates to `lowest`.
+            v = v > lowest ? v : lowest;
+            v = v < highest ? v : highest;
+            output[i] = static_cast<Q>(v);
+        }
+    });
+}
+
+template <typename Q>
+void dequantize_t(const Q* input,
+                  float* output,
+                  std::size_t size,
+                  const quantization& params,
+                  const execution& exec) {
+    const auto zero_point = static_cast<float>(params.zero_point);
+    parallel_for(size, 1, exec, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i != end; ++i) {
+            output[i] = (static_cast<float>(input[i]) - zero_point) * params.scale;
+        }
+    });
+}
+
+// The two source samples and the weight of the second, for one output coordinate of a
+// bilinear resize.
+struct sample {
+    std::size_t first;
+    std::size_t second;
+    float weight;
+};
+
+std::vector<sample> bilinear_samples(std::size_t source, std::size_t target) {
+    std::vector<sample> samples(target);
+    const float ratio = static_cast<float>(source) / static_cast<float>(target);
+    for (std::size_t i = 0; i != target; ++i) {
+        // Align pixel centers rather than pixel edges.
+        float position = (static_cast<float>(i) + 0.5f) * ratio - 0.5f;
+        position = std::min(std::max(position, 0.0f), static_cast<float>(source - 1));
+        const auto first = static_cast<std::size_t>(position);
+        samples[i] = {first, std::min(first + 1, source - 1), position - static_cast<float>(first)};
+    }
+    return samples;
+}
+
+}  // namespace
+
+MLModelService::tensor_views hwc_to_chw(const MLModelService::tensor_views& input,
+                                        void* output,
+                                        std::size_t output_bytes,
+                                        const execution& exec) {
+    return boost::apply_visitor(hwc_to_chw_visitor(output, output_bytes, exec), input);
+}
+
+MLModelService::tensor_view<float> normalize(const MLModelService::tensor_view<std::uint8_t>& input,
+                                             const normalization& norm,
+                                             layout output_layout,
+                                             float* output,
+                                             std::size_t output_size,
+                                             const execution& exec) {
+    const auto s = get_image_shape("normalize", input.shape());
+    check_output("normalize", s.size(), output_size);
+
+    // Fold the normalization into one multiply and one add for each channel.
+    const auto mean = per_channel(norm.mean, s.c, "mean");
+    const auto stddev = per_channel(norm.stddev, s.c, "stddev");
+    std::vector<float> multiplier(s.c);
+    std::vector<float> addend(s.c);
+    for (std::size_t c = 0; c != s.c; ++c) {
+        if (stddev[c] == 0.0f) {
+            fail("normalize", "`stddev` must not have a zero entry");
+        }
+        multiplier[c] = norm.scale / stddev[c];
+        addend[c] = -mean[c] / stddev[c];
+    }
+
+    const std::uint8_t* const source = input.data();
+    const auto row_size = s.w * s.c;
+
+    if (output_layout == layout::k_channels_last) {
+        // Tile the coefficients over a whole number of pixels so that the inner loop runs over
+        // contiguous elements, with no dependence on the channel.
+        const auto tile_pixels = std::max<std::size_t>(std::min<std::size_t>(s.w, 64), 1);
+        const auto tile_size = tile_pixels * s.c;
+        std::vector<float> tiled_multiplier(tile_size);
+        std::vector<float> tiled_addend(tile_size);
+        for (std::size_t i = 0; i != tile_size; ++i) {
+            tiled_multiplier[i] = multiplier[i % s.c];
+            tiled_addend[i] = addend[i % s.c];
+        }
+
+        parallel_for(s.n * s.h, row_size, exec, [&](std::size_t begin, std::size_t end) {
+            const float* const m = tiled_multiplier.data();
+            const float* const a = tiled_addend.data();
+            for (std::size_t offset = begin * row_size; offset < end * row_size;
+                 offset += tile_size) {
+                const auto count = std::min(tile_size, end * row_size - offset);
+                const std::uint8_t* const in = source + offset;
+                float* const out = output + offset;
+                for (std::size_t i = 0; i != count; ++i) {
+                    out[i] = static_cast<float>(in[i]) * m[i] + a[i];
+                }
+            }
+        });
+    } else {
+        const auto plane = s.h * s.w;
+        parallel_for(s.n * s.h, row_size, exec, [&](std::size_t begin, std::size_t end) {
+            for (std::size_t row = begin; row != end; ++row) {
+                const auto n = row / s.h;
+                const auto y = row % s.h;
+                const std::uint8_t* const in = source + row * row_size;
+                for (std::size_t c = 0; c != s.c; ++c) {
+                    float* const out = output + (n * s.c + c) * plane + y * s.w;
+                    const float m = multiplier[c];
+                    const float a = addend[c];
+                    for (std::size_t x = 0; x != s.w; ++x) {
+                        out[x] = static_cast<float>(in[x * s.c + c]) * m + a;
+                    }
+                }
+            }
+        });
+    }
+
+    return MLModelService::make_tensor_view(
+        static_cast<const float*>(output), s.size(), s.with_layout(output_layout));
+}
+
+MLModelService::tensor_view<std::int8_t> quantize(const MLModelService::tensor_view<float>& input,
+                                                  const quantization& params,
+                                                  std::int8_t* output,
+                                                  std::size_t output_size,
+                                                  const execution& exec) {
+    check_output("quantize", input.size(), output_size);
+    quantize_t(input.data(), output, input.size(), params, exec);
+    return MLModelService::make_tensor_view(
+        static_cast<const std::int8_t*>(output), input.size(), input.shape());
+}
+
+MLModelService::tensor_view<std::uint8_t> quantize(const MLModelService::tensor_view<float>& input,
+                                                   const quantization& params,
+                                                   std::uint8_t* output,
+                                                   std::size_t output_size,
+                                                   const execution& exec) {
+    check_output("quantize", input.size(), output_size);
+    quantize_t(input.data(), output, input.size(), params, exec);
+    return MLModelService::make_tensor_view(
+        static_cast<const std::uint8_t*>(output), input.size(), input.shape());
+}
+
+MLModelService::tensor_view<float> dequantize(const MLModelService::tensor_view<std::int8_t>& input,
+                                              const quantization& params,
+                                              float* output,
+                                              std::size_t output_size,
+                                              const execution& exec) {
+    check_output("dequantize", input.size(), output_size);
+    dequantize_t(input.data(), output, input.size(), params, exec);
+    return MLModelService::make_tensor_view(
+        static_cast<const float*>(output), input.size(), input.shape());
+}
+
+MLModelService::tensor_view<float> dequantize(
+    const MLModelService::tensor_view<std::uint8_t>& input,
+    const quantization& params,
+    float* output,
+    std::size_t output_size,
+    const execution& exec) {
+    check_output("dequantize", input.size(), output_size);
+    dequantize_t(input.data(), output, input.size(), params, exec);
+    return MLModelService::make_tensor_view(
+        static_cast<const float*>(output), input.size(), input.shape());
+}
+
+MLModelService::tensor_view<std::uint8_t> letterbox_resize(
+    const MLModelService::tensor_view<std::uint8_t>& input,
+    std::size_t height,
+    std::size_t width,
+    std::uint8_t fill,
+    std::uint8_t* output,
+    std::size_t output_size,
+    letterbox* result,
+    const execution& exec) {
+    const auto s = get_image_shape("letterbox_resize", input.shape());
+    if (s.n != 1) {
+        fail("letterbox_resize", "the input must hold a single image");
+    }
+    if (s.h == 0 || s.w == 0 || height == 0 || width == 0) {
+        fail("letterbox_resize", "the input and output must not be empty");
+    }
+    const image_shape target{s.batched, 1, height, width, s.c};
+    check_output("letterbox_resize", target.size(), output_size);
+
+    letterbox placement;
+    placement.scale = std::min(static_cast<float>(height) / static_cast<float>(s.h),
+                               static_cast<float>(width) / static_cast<float>(s.w));
+    placement.height = std::min(
+        height,
+        std::max<std::size_t>(
+            static_cast<std::size_t>(std::lround(static_cast<float>(s.h) * placement.scale)), 1));
+    placement.width = std::min(
+        width,
+        std::max<std::size_t>(
+            static_cast<std::size_t>(std::lround(static_cast<float>(s.w) * placement.scale)), 1));
+    placement.top = (height - placement.height) / 2;
+    placement.left = (width - placement.width) / 2;
+
+    const auto rows = bilinear_samples(s.h, placement.height);
+    const auto columns = bilinear_samples(s.w, placement.width);
+
+    const std::uint8_t* const source = input.data();
+    const auto source_row_size = s.w * s.c;
+    const auto row_size = width * s.c;
+    const auto left_size = placement.left * s.c;
+    const auto image_size = placement.width * s.c;
+
+    parallel_for(height, row_size, exec, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t y = begin; y != end; ++y) {
+            std::uint8_t* const out = output + y * row_size;
+            if (y < placement.top || y >= placement.top + placement.height) {
+                std::fill(out, out + row_size, fill);
+                continue;
+            }
+
+            std::fill(out, out + left_size, fill);
+            std::fill(out + left_size + image_size, out + row_size, fill);
+
+            const auto& row = rows[y - placement.top];
+            const std::uint8_t* const above = source + row.first * source_row_size;
+            const std::uint8_t* const below = source + row.second * source_row_size;
+            std::uint8_t* const pixels = out + left_size;
+            for (std::size_t x = 0; x != placement.width; ++x) {
+                const auto& column = columns[x];
+                const auto left = column.first * s.c;
+                const auto right = column.second * s.c;
+                for (std::size_t c = 0; c != s.c; ++c) {
+                    const float top = static_cast<float>(above[left + c]) +
+                                      column.weight * static_cast<float>(above[right + c] -
+                                                                         above[left + c]);
+                    const float bottom = static_cast<float>(below[left + c]) +
+                                         column.weight * static_cast<float>(below[right + c] -
+                                                                            below[left + c]);
+                    pixels[x * s.c + c] =
+                        static_cast<std::uint8_t>(top + row.weight * (bottom - top) + 0.5f);
+                }
+            }
+        }
+    });
+
+    if (result) {
+        *result = placement;
+    }
+    return MLModelService::make_tensor_view(static_cast<const std::uint8_t*>(output),
+                                            target.size(),
+                                            target.with_layout(layout::k_channels_last));
+}
+
+}  // namespace tensor_ops
+}  // namespace sdk
+}  // namespace viam
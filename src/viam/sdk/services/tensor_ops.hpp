@@ -0,0 +1,187 @@
+/// @file services/tensor_ops.hpp
+///
+/// @brief Defines the transforms commonly applied to camera frames before they are passed to
+/// `MLModelService::infer`.
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <boost/variant/get.hpp>
+
+#include <viam/sdk/services/mlmodel.hpp>
+
+namespace viam {
+namespace sdk {
+
+/// @namespace tensor_ops
+/// @brief Layout, data type and normalization transforms over `MLModelService` tensors.
+///
+/// Every transform reads a row-major tensor view and writes into a buffer which the caller
+/// provides, so that a buffer can be reused from frame to frame or can be the input buffer of
+/// the model itself. The transform returns a view of the buffer with the shape of its result.
+/// A transform throws an `Exception` if the shape of its input is not one it accepts, or if the
+/// buffer is too small for the result.
+///
+/// The transforms are for callers of `infer`. A model's inputs must have the data types and
+/// shapes which its `metadata` reports, so a caller converts its frames into that form, for
+/// example straight into the buffers it passes as inputs, before calling `infer`.
+///
+/// The inner loops are written to be vectorized by the compiler, and large tensors are split
+/// across threads.
+namespace tensor_ops {
+
+/// @struct execution
+/// @brief How a transform may split its work across threads.
+struct execution {
+    /// @brief The most threads, including the calling thread, to use. Zero means one for each
+    /// hardware thread.
+    std::size_t max_threads = 0;
+
+    /// @brief The fewest elements of output to give each thread. Smaller tensors are transformed
+    /// on the calling thread alone.
+    std::size_t min_elements_per_thread = 1 << 16;
+};
+
+/// @brief Transposes an image from channels last to channels first.
+/// @param input A tensor of shape [H, W, C] or [N, H, W, C], of any data type.
+/// @param output A buffer of at least `output_bytes` bytes, holding elements of the data type of
+/// `input`.
+/// @return A view of `output` with shape [C, H, W] or [N, C, H, W].
+MLModelService::tensor_views hwc_to_chw(const MLModelService::tensor_views& input,
+                                        void* output,
+                                        std::size_t output_bytes,
+                                        const execution& exec = {});
+
+/// @brief Transposes an image from channels last to channels first.
+/// @param input A tensor of shape [H, W, C] or [N, H, W, C].
+/// @param output A buffer of at least `output_size` elements.
+/// @return A view of `output` with shape [C, H, W] or [N, C, H, W].
+template <typename T>
+MLModelService::tensor_view<T> hwc_to_chw(const MLModelService::tensor_view<T>& input,
+                                          T* output,
+                                          std::size_t output_size,
+                                          const execution& exec = {}) {
+    return boost::get<MLModelService::tensor_view<T>>(
+        hwc_to_chw(MLModelService::tensor_views{input}, output, output_size * sizeof(T), exec));
+}
+
+/// @enum layout
+/// @brief The order of the dimensions of an image.
+enum class layout {
+    /// @brief [H, W, C], or [N, H, W, C].
+    k_channels_last,
+
+    /// @brief [C, H, W], or [N, C, H, W].
+    k_channels_first,
+};
+
+/// @struct normalization
+/// @brief The affine map which `normalize` applies to each channel of an image.
+///
+/// Each element `x` of channel `c` becomes `(x * scale - mean[c]) / stddev[c]`. A `mean` or
+/// `stddev` with a single entry applies to every channel.
+struct normalization {
+    /// @brief Applied before the mean is subtracted; 1 / 255 maps bytes onto [0, 1].
+    float scale = 1.0f;
+
+    std::vector<float> mean{0.0f};
+    std::vector<float> stddev{1.0f};
+};
+
+/// @brief Converts an image of bytes to a normalized image of floats.
+/// @param input An image of shape [H, W, C] or [N, H, W, C].
+/// @param norm The normalization to apply to each channel.
+/// @param output_layout The layout of the result; `k_channels_first` transposes the image in the
+/// same pass.
+/// @param output A buffer of at least `output_size` elements.
+/// @return A view of `output` with the shape of `input`, transposed if asked.
+MLModelService::tensor_view<float> normalize(const MLModelService::tensor_view<std::uint8_t>& input,
+                                             const normalization& norm,
+                                             layout output_layout,
+                                             float* output,
+                                             std::size_t output_size,
+                                             const execution& exec = {});
+
+/// @struct quantization
+/// @brief The affine map between real values and their quantized representation, under which
+/// `real = (quantized - zero_point) * scale`.
+struct quantization {
+    float scale = 1.0f;
+    std::int32_t zero_point = 0;
+};
+
+/// @brief Quantizes a tensor, rounding to the nearest representable value and saturating at
+/// the limits of the output type.
+/// @param output A buffer of at least `output_size` elements.
+/// @return A view of `output` with the shape of `input`.
+MLModelService::tensor_view<std::int8_t> quantize(const MLModelService::tensor_view<float>& input,
+                                                  const quantization& params,
+                                                  std::int8_t* output,
+                                                  std::size_t output_size,
+                                                  const execution& exec = {});
+
+/// @copydoc quantize
+MLModelService::tensor_view<std::uint8_t> quantize(const MLModelService::tensor_view<float>& input,
+                                                   const quantization& params,
+                                                   std::uint8_t* output,
+                                                   std::size_t output_size,
+                                                   const execution& exec = {});
+
+/// @brief Recovers the real values of a quantized tensor.
+/// @param output A buffer of at least `output_size` elements.
+/// @return A view of `output` with the shape of `input`.
+MLModelService::tensor_view<float> dequantize(const MLModelService::tensor_view<std::int8_t>& input,
+                                              const quantization& params,
+                                              float* output,
+                                              std::size_t output_size,
+                                              const execution& exec = {});
+
+/// @copydoc dequantize
+MLModelService::tensor_view<float> dequantize(
+    const MLModelService::tensor_view<std::uint8_t>& input,
+    const quantization& params,
+    float* output,
+    std::size_t output_size,
+    const execution& exec = {});
+
+/// @struct letterbox
+/// @brief Where `letterbox_resize` placed the resized image within its output, which is what a
+/// caller needs to map coordinates reported by the model back onto the original image.
+struct letterbox {
+    /// @brief The factor by which the image was scaled, in both dimensions.
+    float scale;
+
+    /// @brief The columns of padding to the left of the resized image.
+    std::size_t left;
+
+    /// @brief The rows of padding above the resized image.
+    std::size_t top;
+
+    /// @brief The size of the resized image, excluding the padding.
+    std::size_t width;
+    std::size_t height;
+};
+
+/// @brief Resizes an image to fit within `height` x `width` while keeping its aspect ratio, and
+/// pads the rest of the output evenly on both sides with `fill`. Pixels are interpolated
+/// bilinearly.
+/// @param input An image of shape [H, W, C] or [1, H, W, C].
+/// @param output A buffer of at least `output_size` elements.
+/// @param result If not null, receives the placement of the resized image.
+/// @return A view of `output` with shape [height, width, C], with the leading dimension of
+/// `input` kept if it has one.
+MLModelService::tensor_view<std::uint8_t> letterbox_resize(
+    const MLModelService::tensor_view<std::uint8_t>& input,
+    std::size_t height,
+    std::size_t width,
+    std::uint8_t fill,
+    std::uint8_t* output,
+    std::size_t output_size,
+    letterbox* result = nullptr,
+    const execution& exec = {});
+
+}  // namespace tensor_ops
+}  // namespace sdk
+}  // namespace viam
@@ -32,6 +32,7 @@ std::shared_ptr<sdk::MLModelService::named_tensor_views> MockMLModelService::inf
 
 MockMLModelService& MockMLModelService::set_metadata(struct metadata metadata) {
     metadata_ = std::move(metadata);
+    metadata_changed();
     return *this;
 }
 
@@ -1,4 +1,6 @@
 #define BOOST_TEST_MODULE test module test_audio_in
+#include <vector>
+
 #include <boost/optional/optional_io.hpp>
 #include <boost/qvm/all.hpp>
 #include <boost/test/included/unit_test.hpp>
@@ -97,6 +99,29 @@ BOOST_AUTO_TEST_CASE(test_get_audio_request_ids_differ_across_calls) {
     });
 }
 
+BOOST_AUTO_TEST_CASE(test_get_audio_reuses_chunk_buffers) {
+    std::shared_ptr<MockAudioIn> mock = MockAudioIn::get_mock_audio_in();
+
+    client_to_mock_pipeline<AudioIn>(mock, [&](AudioIn& client) {
+        // A handler which leaves the chunk alone should see the same buffer every time.
+        std::vector<const uint8_t*> buffers;
+        client.get_audio(
+            audio_codecs::PCM_16,
+            [&](AudioIn::audio_chunk&& chunk) -> bool {
+                BOOST_CHECK_EQUAL(chunk.audio_data.size(), 1024);
+                buffers.push_back(chunk.audio_data.data());
+                return buffers.size() < 4;
+            },
+            1.0,
+            0);
+
+        BOOST_REQUIRE_EQUAL(buffers.size(), 4);
+        for (const auto* buffer : buffers) {
+            BOOST_CHECK(buffer == buffers.front());
+        }
+    });
+}
+
 BOOST_AUTO_TEST_CASE(test_do_command) {
     std::shared_ptr<MockAudioIn> mock = MockAudioIn::get_mock_audio_in();
     client_to_mock_pipeline<AudioIn>(mock, [](AudioIn& client) {
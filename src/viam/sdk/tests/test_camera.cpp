@@ -1,5 +1,9 @@
 #define BOOST_TEST_MODULE test module test_camera
 
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <thread>
 #include <typeinfo>
 #include <unordered_map>
 #include <utility>
@@ -7,8 +11,10 @@
 
 #include <boost/test/included/unit_test.hpp>
 
+#include <viam/sdk/common/exception.hpp>
 #include <viam/sdk/common/proto_value.hpp>
 #include <viam/sdk/components/camera.hpp>
+#include <viam/sdk/components/frame_pipeline.hpp>
 #include <viam/sdk/spatialmath/geometry.hpp>
 #include <viam/sdk/tests/mocks/camera_mocks.hpp>
 #include <viam/sdk/tests/test_utils.hpp>
@@ -59,6 +65,21 @@ BOOST_AUTO_TEST_CASE(test_get_images_filtering) {
     });
 }
 
+BOOST_AUTO_TEST_CASE(test_get_images_async) {
+    std::shared_ptr<MockCamera> mock = MockCamera::get_mock_camera();
+    client_to_mock_pipeline<Camera>(mock, [&](Camera& client) {
+        std::future<Camera::image_collection> all_images = client.get_images_async();
+        std::future<Camera::image_collection> color_images =
+            client.get_images_async({"color"}, {});
+
+        BOOST_CHECK(all_images.get() == fake_raw_images());
+
+        Camera::image_collection images = color_images.get();
+        BOOST_REQUIRE_EQUAL(images.images.size(), 1);
+        BOOST_CHECK_EQUAL(images.images[0].source_name, "color");
+    });
+}
+
 BOOST_AUTO_TEST_CASE(test_get_images_with_extra) {
     std::shared_ptr<MockCamera> mock = MockCamera::get_mock_camera();
     client_to_mock_pipeline<Camera>(mock, [&](Camera& client) {
@@ -114,6 +135,97 @@ BOOST_AUTO_TEST_CASE(test_do_command) {
     });
 }
 
+BOOST_AUTO_TEST_CASE(test_frame_pipeline_every_frame) {
+    std::shared_ptr<MockCamera> mock = MockCamera::get_mock_camera();
+
+    FramePipeline::options opts;
+    opts.delivery = FramePipeline::options::delivery_mode::k_every_frame;
+    opts.in_flight = 1;
+    opts.queue_capacity = 2;
+    FramePipeline pipeline(mock, opts);
+
+    const Camera::image_collection expected = fake_raw_images();
+    for (int i = 0; i < 5; ++i) {
+        auto frame = pipeline.next();
+        BOOST_REQUIRE(frame);
+        BOOST_CHECK(frame->images.images == expected.images);
+        BOOST_CHECK(frame->images.metadata == expected.metadata);
+        BOOST_CHECK_GT(frame->latency.count(), 0);
+    }
+
+    pipeline.stop();
+    const auto stats = pipeline.get_stats();
+    BOOST_CHECK_EQUAL(stats.frames_delivered, 5);
+    BOOST_CHECK_EQUAL(stats.frames_dropped, 0);
+    BOOST_CHECK_EQUAL(stats.errors, 0);
+    BOOST_CHECK_GT(stats.mean_latency.count(), 0);
+    BOOST_CHECK_GE(stats.max_latency.count(), stats.last_latency.count());
+}
+
+BOOST_AUTO_TEST_CASE(test_frame_pipeline_error_keeps_latest_frame) {
+    // Returns one frame, then fails on every call after it.
+    class FailingCamera : public MockCamera {
+       public:
+        using MockCamera::MockCamera;
+
+        image_collection get_images(std::vector<std::string> filter_source_names,
+                                    const sdk::ProtoStruct& extra) override {
+            if (calls_++ > 0) {
+                throw Exception("camera disconnected");
+            }
+            return MockCamera::get_images(std::move(filter_source_names), extra);
+        }
+
+       private:
+        std::atomic<int> calls_{0};
+    };
+
+    FramePipeline::options opts;
+    opts.in_flight = 1;
+    opts.retry_interval = std::chrono::milliseconds(1);
+    FramePipeline pipeline(std::make_shared<FailingCamera>("failing_camera"), opts);
+
+    // Wait for a failure to follow the frame, which must not push the frame out of the queue.
+    while (pipeline.get_stats().errors == 0) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    BOOST_CHECK(pipeline.next(std::chrono::seconds(5)));
+    BOOST_CHECK_THROW(pipeline.next(std::chrono::seconds(5)), Exception);
+
+    pipeline.stop();
+    const auto stats = pipeline.get_stats();
+    BOOST_CHECK_EQUAL(stats.frames_delivered, 1);
+    BOOST_CHECK_EQUAL(stats.frames_dropped, 0);
+    BOOST_CHECK_GE(stats.errors, 2);
+}
+
+BOOST_AUTO_TEST_CASE(test_frame_pipeline_client) {
+    std::shared_ptr<MockCamera> mock = MockCamera::get_mock_camera();
+    client_to_mock_pipeline<Camera>(mock, [](Camera& client) {
+        FramePipeline::options opts;
+        opts.in_flight = 1;
+        opts.filter_source_names = {"color"};
+
+        // The client outlives the pipeline, so it can be shared without ownership.
+        FramePipeline pipeline(std::shared_ptr<Camera>(std::shared_ptr<Camera>(), &client), opts);
+
+        auto frame = pipeline.next(std::chrono::seconds(5));
+        BOOST_REQUIRE(frame);
+        BOOST_REQUIRE_EQUAL(frame->images.images.size(), 1);
+        BOOST_CHECK_EQUAL(frame->images.images[0].source_name, "color");
+
+        // Frames already queued can still be consumed after stopping, and then the pipeline
+        // reports that it is empty.
+        pipeline.stop();
+        int drained = 0;
+        while (pipeline.next()) {
+            ++drained;
+        }
+        BOOST_CHECK_LE(drained, 1);
+        BOOST_CHECK_EQUAL(pipeline.get_stats().frames_delivered, 1 + drained);
+    });
+}
+
 BOOST_AUTO_TEST_CASE(test_depth_map_encode_decode) {
     xt::xarray<uint16_t> depth_map =
         xt::xarray<uint16_t>::from_shape({3, 2});  // height = 3, width = 2
@@ -138,6 +250,43 @@ BOOST_AUTO_TEST_CASE(test_depth_map_encode_decode) {
         result_values.begin(), result_values.end(), expected_values.begin(), expected_values.end());
 }
 
+BOOST_AUTO_TEST_CASE(test_depth_map_view_and_decode_into) {
+    // An odd number of values, so that both the vectorized and the scalar paths are exercised.
+    const std::size_t height = 7;
+    const std::size_t width = 13;
+    xt::xarray<uint16_t> depth_map = xt::xarray<uint16_t>::from_shape({height, width});
+    for (std::size_t i = 0; i < depth_map.size(); ++i) {
+        depth_map.data()[i] = static_cast<uint16_t>(i * 257 + 1);
+    }
+
+    std::vector<unsigned char> data = Camera::encode_depth_map(depth_map);
+
+    // Values follow the 24 byte header in big-endian order.
+    BOOST_CHECK_EQUAL(data.size(), 24 + height * width * 2);
+    BOOST_CHECK_EQUAL(data[24 + 2 * 3], 3);
+    BOOST_CHECK_EQUAL(data[24 + 2 * 3 + 1], 4);
+
+    const SharedBytes bytes(data);
+    const Camera::depth_map_view view = Camera::view_depth_map(bytes);
+    BOOST_CHECK_EQUAL(view.height, height);
+    BOOST_CHECK_EQUAL(view.width, width);
+    BOOST_CHECK_EQUAL(view(0, 0), depth_map(0, 0));
+    BOOST_CHECK_EQUAL(view(4, 9), depth_map(4, 9));
+    BOOST_CHECK_EQUAL(view(height - 1, width - 1), depth_map(height - 1, width - 1));
+
+    xt::xarray<uint16_t> out = xt::xarray<uint16_t>::from_shape({width, height});
+    const uint16_t* storage = out.data();
+    Camera::decode_depth_map(data.data(), data.size(), out);
+
+    BOOST_CHECK_EQUAL(out.shape()[0], height);
+    BOOST_CHECK_EQUAL(out.shape()[1], width);
+    BOOST_CHECK(out.data() == storage);
+    BOOST_CHECK(out == depth_map);
+
+    data.pop_back();
+    BOOST_CHECK_THROW(Camera::view_depth_map(data.data(), data.size()), Exception);
+}
+
 BOOST_AUTO_TEST_CASE(test_get_status) {
     std::shared_ptr<MockCamera> mock = MockCamera::get_mock_camera();
     client_to_mock_pipeline<Camera>(mock, [](Camera& client) {
@@ -2,10 +2,15 @@
 
 #include <boost/test/included/unit_test.hpp>
 
+#include <google/protobuf/arena.h>
 #include <google/protobuf/duration.pb.h>
+#include <google/protobuf/struct.pb.h>
 
 #include <viam/api/common/v1/common.pb.h>
 
+#include <viam/sdk/common/client_helper.hpp>
+#include <viam/sdk/common/private/service_helper.hpp>
+#include <viam/sdk/common/shared_bytes.hpp>
 #include <viam/sdk/common/utils.hpp>
 #include <viam/sdk/common/version_metadata.hpp>
 #include <viam/sdk/tests/test_utils.hpp>
@@ -111,6 +116,48 @@ BOOST_AUTO_TEST_CASE(test_from_dm_from_extra) {
     BOOST_CHECK_EQUAL(from_dm_from_extra(map), false);
 }
 
+BOOST_AUTO_TEST_CASE(test_from_dm_from_extra_view) {
+    for (const ProtoStruct& map : {fake_map(),
+                                   ProtoStruct{{"fromDataManagement", true}},
+                                   ProtoStruct{{"fromDataManagement", false}},
+                                   ProtoStruct{{"fromDataManagement", "hello"}},
+                                   ProtoStruct{{"fromDataManagement", 3.5}}}) {
+        const google::protobuf::Struct proto = to_proto(map);
+        BOOST_CHECK_EQUAL(from_dm_from_extra(ProtoStructView(proto)), from_dm_from_extra(map));
+    }
+
+    BOOST_CHECK_EQUAL(from_dm_from_extra(ProtoStructView()), false);
+}
+
+BOOST_AUTO_TEST_CASE(test_request_extra) {
+    const auto as_struct = [](const impl::RequestExtra& extra) -> const ProtoStruct& {
+        return extra;
+    };
+
+    // The extra of a capture, and an empty one, are shared between requests.
+    const ProtoStruct capture{{"fromDataManagement", true}};
+    const google::protobuf::Struct capture_proto = to_proto(capture);
+    const impl::RequestExtra first{ProtoStructView(capture_proto)};
+    const impl::RequestExtra second{ProtoStructView(capture_proto)};
+    BOOST_CHECK(as_struct(first) == capture);
+    BOOST_CHECK(from_dm_from_extra(first));
+    BOOST_CHECK_EQUAL(&as_struct(first), &as_struct(second));
+
+    const google::protobuf::Struct empty_proto;
+    const impl::RequestExtra empty{ProtoStructView(empty_proto)};
+    const impl::RequestExtra absent{ProtoStructView()};
+    BOOST_CHECK(as_struct(empty).empty());
+    BOOST_CHECK_EQUAL(&as_struct(empty), &as_struct(absent));
+
+    // Anything else is converted.
+    for (const ProtoStruct& map : {fake_map(),
+                                   ProtoStruct{{"fromDataManagement", false}},
+                                   ProtoStruct{{"fromDataManagement", true}, {"other", 1.0}}}) {
+        const google::protobuf::Struct proto = to_proto(map);
+        BOOST_CHECK(as_struct(impl::RequestExtra(ProtoStructView(proto))) == map);
+    }
+}
+
 BOOST_AUTO_TEST_CASE(test_version_metadata) {
     // we don't want to check the specific values because they're going to be changing,
     // but we want to confirm that the parsing works and extracts an int value successfully.
@@ -144,5 +191,75 @@ BOOST_AUTO_TEST_CASE(test_name_conversion) {
 
 BOOST_AUTO_TEST_SUITE_END()
 
+BOOST_AUTO_TEST_SUITE(test_shared_bytes)
+
+BOOST_AUTO_TEST_CASE(test_copies_share_storage) {
+    const SharedBytes bytes(std::vector<unsigned char>{1, 2, 3, 4});
+    const SharedBytes copy = bytes;  // NOLINT(performance-unnecessary-copy-initialization)
+
+    BOOST_CHECK_EQUAL(copy.data(), bytes.data());
+    BOOST_CHECK(copy == bytes);
+    BOOST_CHECK(copy == (std::vector<unsigned char>{1, 2, 3, 4}));
+    BOOST_CHECK(!(copy == (std::vector<unsigned char>{1, 2, 3})));
+}
+
+BOOST_AUTO_TEST_CASE(test_release_string) {
+    std::string payload(1024, 'x');
+    const char* const original = payload.data();
+
+    SharedBytes bytes(std::move(payload));
+    std::string released = bytes.release_string();
+    BOOST_CHECK_EQUAL(released.size(), 1024);
+    BOOST_CHECK_EQUAL(static_cast<const void*>(released.data()),
+                      static_cast<const void*>(original));
+    BOOST_CHECK(bytes.empty());
+
+    // A shared buffer must be copied so the other reference is left intact.
+    SharedBytes shared(std::move(released));
+    const SharedBytes other = shared;
+    const std::string copied = shared.release_string();
+    BOOST_CHECK_EQUAL(copied, std::string(1024, 'x'));
+    BOOST_CHECK_EQUAL(other.size(), 1024);
+    BOOST_CHECK_NE(static_cast<const void*>(copied.data()),
+                   static_cast<const void*>(other.data()));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(test_call_arena)
+
+BOOST_AUTO_TEST_CASE(test_call_arena_nesting_and_reset) {
+    using client_helper_details::CallArena;
+
+    google::protobuf::Arena* arena = nullptr;
+    {
+        CallArena outer;
+        arena = outer.get();
+        auto* message = google::protobuf::Struct::default_instance().New(outer.get());
+        (*message->mutable_fields())["key"].set_string_value("value");
+        const auto used = arena->SpaceUsed();
+        BOOST_CHECK_GT(used, 0);
+
+        {
+            // A call made while another is in progress on the same thread shares its arena, and
+            // releasing it doesn't reset the arena under the outer call.
+            CallArena inner;
+            BOOST_CHECK_EQUAL(inner.get(), arena);
+        }
+        BOOST_CHECK_EQUAL(arena->SpaceUsed(), used);
+        BOOST_CHECK_EQUAL(message->fields().at("key").string_value(), "value");
+
+        CallArena moved(std::move(outer));
+        BOOST_CHECK_EQUAL(moved.get(), arena);
+    }
+
+    // Releasing the last handle resets the arena for the next call.
+    const CallArena next;
+    BOOST_CHECK_EQUAL(next.get(), arena);
+    BOOST_CHECK_EQUAL(next.get()->SpaceUsed(), 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
 }  // namespace sdktests
 }  // namespace viam
@@ -6,6 +6,11 @@
 #include <iostream>
 #include <sstream>
 
+#include <boost/log/core/core.hpp>
+
+#include <robot/v1/robot.pb.h>
+
+#include <viam/sdk/log/private/log_backend.hpp>
 #include <viam/sdk/resource/resource.hpp>
 #include <viam/sdk/tests/mocks/mock_sensor.hpp>
 #include <viam/sdk/tests/test_utils.hpp>
@@ -190,6 +195,92 @@ BOOST_AUTO_TEST_CASE(test_resource_filter) {
     BOOST_CHECK(errLogs.back().find("sensor error") != std::string::npos);
 }
 
+// Installs a shipping sink which records the batches it is asked to send instead of sending them.
+struct shipping_sink {
+    explicit shipping_sink(const sdk::LogManager::shipping_options& opts)
+        : sink(boost::make_shared<sdk::impl::SinkType>(boost::make_shared<sdk::impl::LogBackend>(
+              [this](viam::robot::v1::LogRequest& req) {
+                  std::vector<std::string> batch;
+                  for (const auto& entry : req.logs()) {
+                      batch.push_back(entry.message());
+                  }
+                  batches.push_back(std::move(batch));
+                  return true;
+              },
+              opts))) {
+        boost::log::core::get()->add_sink(sink);
+    }
+
+    ~shipping_sink() {
+        boost::log::core::get()->remove_sink(sink);
+    }
+
+    std::vector<std::vector<std::string>> batches;
+    boost::shared_ptr<sdk::impl::SinkType> sink;
+};
+
+BOOST_AUTO_TEST_CASE(test_shipping_batches) {
+    cout_redirect redirect;
+
+    sdk::LogManager::shipping_options opts;
+    opts.max_batch_entries = 4;
+    opts.flush_interval = std::chrono::hours(1);
+
+    const auto before = sdk::LogManager::get().get_shipping_stats();
+
+    shipping_sink shipper(opts);
+    for (int i = 0; i < 10; ++i) {
+        VIAM_SDK_LOG(info) << "shipped" << i;
+    }
+    shipper.sink->flush();
+
+    redirect.release();
+
+    std::vector<std::string> messages;
+    for (const auto& batch : shipper.batches) {
+        BOOST_CHECK_LE(batch.size(), opts.max_batch_entries);
+        messages.insert(messages.end(), batch.begin(), batch.end());
+    }
+
+    BOOST_REQUIRE_EQUAL(messages.size(), 10);
+    for (int i = 0; i < 10; ++i) {
+        BOOST_CHECK_EQUAL(messages[i], "shipped" + std::to_string(i));
+    }
+
+    const auto after = sdk::LogManager::get().get_shipping_stats();
+    BOOST_CHECK_EQUAL(after.flushed_records - before.flushed_records, 10);
+    BOOST_CHECK_EQUAL(after.batches - before.batches, shipper.batches.size());
+    BOOST_CHECK_EQUAL(after.dropped_records, before.dropped_records);
+}
+
+BOOST_AUTO_TEST_CASE(test_shipping_drop_oldest) {
+    cout_redirect redirect;
+
+    sdk::LogManager::shipping_options opts;
+    opts.queue_capacity = 4;
+    opts.max_batch_entries = 100;
+    opts.flush_interval = std::chrono::hours(1);
+    opts.overflow = sdk::LogManager::shipping_options::overflow_policy::k_drop_oldest;
+
+    const auto before = sdk::LogManager::get().get_shipping_stats();
+
+    shipping_sink shipper(opts);
+    for (int i = 0; i < 10; ++i) {
+        VIAM_SDK_LOG(info) << "queued" << i;
+    }
+    shipper.sink->flush();
+
+    redirect.release();
+
+    BOOST_REQUIRE_EQUAL(shipper.batches.size(), 1);
+    const std::vector<std::string> expected{"queued6", "queued7", "queued8", "queued9"};
+    BOOST_CHECK(shipper.batches.front() == expected);
+
+    const auto after = sdk::LogManager::get().get_shipping_stats();
+    BOOST_CHECK_EQUAL(after.flushed_records - before.flushed_records, 4);
+    BOOST_CHECK_EQUAL(after.dropped_records - before.dropped_records, 6);
+}
+
 BOOST_AUTO_TEST_CASE(filename_trim) {
     using namespace log_detail;
 
@@ -15,13 +15,29 @@
 #define BOOST_TEST_MODULE test module test_mlmodel
 #include <viam/sdk/services/mlmodel.hpp>
 
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <future>
 #include <memory>
+#include <mutex>
+#include <numeric>
 #include <tuple>
 #include <unordered_map>
+#include <vector>
 
 #include <boost/test/included/unit_test.hpp>
 #include <boost/variant/get.hpp>
-
+#include <grpcpp/server.h>
+#include <grpcpp/server_builder.h>
+#include <grpcpp/support/channel_arguments.h>
+
+#include <viam/sdk/services/batching_mlmodel.hpp>
+#include <viam/sdk/services/private/mlmodel.hpp>
+#include <viam/sdk/services/private/mlmodel_client.hpp>
+#include <viam/sdk/services/private/mlmodel_shared_memory.hpp>
+#include <viam/sdk/services/tensor_ops.hpp>
 #include <viam/sdk/tests/mocks/mlmodel_mocks.hpp>
 #include <viam/sdk/tests/test_utils.hpp>
 
@@ -314,6 +330,99 @@ BOOST_AUTO_TEST_CASE(mock_infer_grpc_roundtrip) {
     });
 }
 
+BOOST_AUTO_TEST_CASE(mock_infer_grpc_metadata_changed) {
+    auto mock = std::make_shared<MockMLModelService>();
+
+    const auto make_metadata = [](MLModelService::tensor_info::data_types second_type) {
+        return MLModelService::metadata{
+            "",
+            "",
+            "",
+            {{"x", "", MLModelService::tensor_info::data_types::k_float32, {1}, {}, {}},
+             {"y", "", second_type, {1}, {}, {}}},
+            {}};
+    };
+
+    mock->set_metadata(make_metadata(MLModelService::tensor_info::data_types::k_float32));
+    mock->set_infer_handler([](const MLModelService::named_tensor_views& request) {
+        BOOST_REQUIRE(request.size() == 2);
+        return std::make_shared<MLModelService::named_tensor_views>();
+    });
+
+    client_to_mock_pipeline<MLModelService>(mock, [&mock, &make_metadata](auto& client) {
+        const std::array<float, 1> data{};
+        MLModelService::named_tensor_views request;
+        request.emplace("x", MLModelService::make_tensor_view(data.data(), data.size(), {1}));
+        request.emplace("y", MLModelService::make_tensor_view(data.data(), data.size(), {1}));
+
+        BOOST_CHECK(client.infer(request)->empty());
+        BOOST_CHECK(client.infer(request)->empty());
+
+        // The server must notice that the metadata changed rather than binding the request
+        // against what it saw on the first call.
+        mock->set_metadata(make_metadata(MLModelService::tensor_info::data_types::k_int32));
+        BOOST_CHECK_THROW(client.infer(request), std::exception);
+    });
+}
+
+// A model which, like a service reconfigured in place, changes its inputs without calling
+// `metadata_changed`.
+class ReconfiguredInPlaceModel : public MockMLModelService {
+   public:
+    void reconfigure(struct metadata metadata) {
+        const std::lock_guard<std::mutex> lock(lock_);
+        metadata_ = std::move(metadata);
+    }
+
+    struct metadata metadata(const ProtoStruct&) override {
+        const std::lock_guard<std::mutex> lock(lock_);
+        return metadata_;
+    }
+
+   private:
+    std::mutex lock_;
+    struct metadata metadata_;
+};
+
+BOOST_AUTO_TEST_CASE(mock_infer_grpc_reconfigured_in_place) {
+    const auto make_metadata = [](const char* first, const char* second) {
+        return MLModelService::metadata{
+            "",
+            "",
+            "",
+            {{first, "", MLModelService::tensor_info::data_types::k_float32, {1}, {}, {}},
+             {second, "", MLModelService::tensor_info::data_types::k_float32, {1}, {}, {}}},
+            {}};
+    };
+
+    auto model = std::make_shared<ReconfiguredInPlaceModel>();
+    model->reconfigure(make_metadata("x", "y"));
+    model->set_infer_handler([](const MLModelService::named_tensor_views& request) {
+        BOOST_REQUIRE(request.size() == 2);
+        return std::make_shared<MLModelService::named_tensor_views>();
+    });
+
+    client_to_mock_pipeline<MLModelService>(model, [&](auto& client) {
+        const std::array<float, 1> data{};
+        const auto make_request = [&](const char* first, const char* second) {
+            MLModelService::named_tensor_views request;
+            request.emplace(first, MLModelService::make_tensor_view(data.data(), data.size(), {1}));
+            request.emplace(second,
+                            MLModelService::make_tensor_view(data.data(), data.size(), {1}));
+            return request;
+        };
+
+        BOOST_CHECK(client.infer(make_request("x", "y"))->empty());
+
+        // The server checks requests which the binding it cached rejects against the current
+        // metadata, so the new inputs are accepted and the old ones no longer are.
+        model->reconfigure(make_metadata("a", "b"));
+        BOOST_CHECK(client.infer(make_request("a", "b"))->empty());
+        BOOST_CHECK(client.infer(make_request("a", "b"))->empty());
+        BOOST_CHECK_THROW(client.infer(make_request("x", "y")), std::exception);
+    });
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 BOOST_AUTO_TEST_SUITE(test_mlmodel_bugfixes)
@@ -359,6 +468,433 @@ BOOST_AUTO_TEST_CASE(RSDK_10768) {
 
 BOOST_AUTO_TEST_SUITE_END()
 
+BOOST_AUTO_TEST_SUITE(test_tensor_conversion)
+
+BOOST_AUTO_TEST_CASE(test_storage_reuses_released_buffers) {
+    const std::vector<float> data(224 * 224 * 3, 0.5F);
+    ::viam::service::mlmodel::v1::FlatTensor api_tensor;
+    impl::mlmodel::copy_sdk_tensor_to_api_tensor(
+        MLModelService::make_tensor_view(data.data(), data.size(), {1, 224, 224, 3}), &api_tensor);
+
+    const float* first = nullptr;
+    for (int i = 0; i < 3; ++i) {
+        impl::mlmodel::tensor_storage storage;
+        const auto tensor = impl::mlmodel::make_sdk_tensor_from_api_tensor(api_tensor, &storage);
+        const auto& view = boost::get<MLModelService::tensor_view<float>>(tensor);
+        BOOST_TEST(std::vector<float>(view.begin(), view.end()) == data,
+                   boost::test_tools::per_element());
+
+        // Each iteration's storage is released before the next, which gets the same buffer back.
+        if (i == 0) {
+            first = view.data();
+        } else {
+            BOOST_TEST(view.data() == first);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_storage_keeps_odd_16_bit_tensors) {
+    const std::vector<std::int16_t> data = {1, -2, 3};
+    ::viam::service::mlmodel::v1::FlatTensor api_tensor;
+    impl::mlmodel::copy_sdk_tensor_to_api_tensor(
+        MLModelService::make_tensor_view(data.data(), data.size(), {3}), &api_tensor);
+
+    impl::mlmodel::tensor_storage storage;
+    const auto tensor = impl::mlmodel::make_sdk_tensor_from_api_tensor(api_tensor, &storage);
+    const auto& view = boost::get<MLModelService::tensor_view<std::int16_t>>(tensor);
+    BOOST_TEST(std::vector<std::int16_t>(view.begin(), view.end()) == data,
+               boost::test_tools::per_element());
+}
+
+BOOST_AUTO_TEST_CASE(test_16_bit_wire_format) {
+    // Two elements to a word, the first in the low half, whatever the host byte order.
+    const std::vector<std::int16_t> data = {1, -2, 3};
+    ::viam::service::mlmodel::v1::FlatTensor api_tensor;
+    impl::mlmodel::copy_sdk_tensor_to_api_tensor(
+        MLModelService::make_tensor_view(data.data(), data.size(), {3}), &api_tensor);
+
+    const auto& words = api_tensor.int16_tensor().data();
+    BOOST_REQUIRE_EQUAL(words.size(), 2);
+    BOOST_TEST(words.Get(0) == 0xFFFE0001U);
+    BOOST_TEST(words.Get(1) == 3U);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(test_mlmodel_shared_memory)
+
+BOOST_AUTO_TEST_CASE(test_large_inputs_round_trip) {
+    // Clients read the threshold when they are created.
+    ::setenv("VIAM_MLMODEL_SHARED_MEMORY_MIN_BYTES", "1024", 1);  // NOLINT(concurrency-mt-unsafe)
+
+    const struct MLModelService::tensor_info image {
+        "image", "", MLModelService::tensor_info::data_types::k_uint8, {1, 64, 64, 3}, {}, {}
+    };
+    const struct MLModelService::tensor_info threshold {
+        "threshold", "", MLModelService::tensor_info::data_types::k_float32, {1}, {}, {}
+    };
+    auto mock = std::make_shared<MockMLModelService>();
+    mock->set_metadata({"foo", "bar", "baz", {image, threshold}, {}});
+
+    std::vector<std::uint8_t> pixels(64 * 64 * 3);
+    for (std::size_t i = 0; i < pixels.size(); ++i) {
+        pixels[i] = static_cast<std::uint8_t>(i);
+    }
+    const std::array<float, 1> cutoff{0.25F};
+
+    mock->set_infer_handler([&](const MLModelService::named_tensor_views& request) {
+        const auto& received = boost::get<MLModelService::tensor_view<std::uint8_t>>(
+            request.at("image"));
+        BOOST_TEST(std::vector<std::uint8_t>(received.begin(), received.end()) == pixels,
+                   boost::test_tools::per_element());
+        BOOST_TEST(boost::get<MLModelService::tensor_view<float>>(request.at("threshold"))(0) ==
+                   0.25F);
+        return std::make_shared<MLModelService::named_tensor_views>();
+    });
+
+    client_to_mock_pipeline<MLModelService>(mock, [&](auto& client) {
+        MLModelService::named_tensor_views request;
+        request.emplace(
+            "image",
+            MLModelService::make_tensor_view(pixels.data(), pixels.size(), {1, 64, 64, 3}));
+        request.emplace("threshold", MLModelService::make_tensor_view(cutoff.data(), 1, {1}));
+        // The first call learns that the server accepts shared memory, the second sends the image
+        // through it, and the third reuses the second call's segment.
+        client.infer(request);
+        client.infer(request);
+        client.infer(request);
+    });
+
+    ::unsetenv("VIAM_MLMODEL_SHARED_MEMORY_MIN_BYTES");  // NOLINT(concurrency-mt-unsafe)
+}
+
+BOOST_AUTO_TEST_CASE(test_server_without_shared_memory) {
+    ::setenv("VIAM_MLMODEL_SHARED_MEMORY_MIN_BYTES", "1024", 1);  // NOLINT(concurrency-mt-unsafe)
+
+    // Answers the way a server which doesn't know the shared memory key does: it ignores the key,
+    // and fails calls which are missing an input.
+    class LegacyServer : public ::viam::service::mlmodel::v1::MLModelService::Service {
+       public:
+        ::grpc::Status Infer(::grpc::ServerContext*,
+                             const ::viam::service::mlmodel::v1::InferRequest* request,
+                             ::viam::service::mlmodel::v1::InferResponse*) override {
+            if (request->extra().fields().count(impl::mlmodel::k_shared_memory_key) != 0) {
+                ++shared_memory_requests;
+            }
+            if (request->input_tensors().tensors().count("image") == 0) {
+                return {::grpc::INVALID_ARGUMENT, "Expected tensor input `image` was not found"};
+            }
+            return ::grpc::Status::OK;
+        }
+
+        std::atomic<int> shared_memory_requests{0};
+    };
+
+    LegacyServer service;
+    grpc::ServerBuilder builder;
+    builder.RegisterService(&service);
+    const std::unique_ptr<grpc::Server> server = builder.BuildAndStart();
+    const ViamChannel channel(server->InProcessChannel(grpc::ChannelArguments()));
+    impl::MLModelServiceClient client("legacy", channel);
+
+    std::vector<std::uint8_t> pixels(64 * 64 * 3);
+    MLModelService::named_tensor_views request;
+    request.emplace("image",
+                    MLModelService::make_tensor_view(pixels.data(), pixels.size(), {1, 64, 64, 3}));
+    for (int i = 0; i < 3; ++i) {
+        BOOST_CHECK_NO_THROW(client.infer(request));
+    }
+    BOOST_CHECK_EQUAL(service.shared_memory_requests.load(), 0);
+
+    server->Shutdown();
+    ::unsetenv("VIAM_MLMODEL_SHARED_MEMORY_MIN_BYTES");  // NOLINT(concurrency-mt-unsafe)
+}
+
+BOOST_AUTO_TEST_CASE(test_unmappable_segment_is_reported) {
+    auto mock = std::make_shared<MockMLModelService>();
+    mock->set_infer_handler([](const MLModelService::named_tensor_views&) {
+        BOOST_FAIL("The request should not reach the model");
+        return std::make_shared<MLModelService::named_tensor_views>();
+    });
+
+    channel_to_mock_pipeline(mock, [&](const std::shared_ptr<grpc::Channel>& channel) {
+        ::viam::service::mlmodel::v1::InferRequest request;
+        ::viam::service::mlmodel::v1::InferResponse response;
+        request.set_name(mock->name());
+        request.mutable_input_tensors();
+        auto& description =
+            *(*request.mutable_extra()->mutable_fields())[impl::mlmodel::k_shared_memory_key]
+                 .mutable_struct_value()
+                 ->mutable_fields();
+        description["segment"].set_string_value("/viam-mlmodel-does-not-exist");
+        description["tensors"].mutable_struct_value();
+
+        // Clients recognize this status, and send the request again as protobuf.
+        grpc::ClientContext ctx;
+        const auto status = ::viam::service::mlmodel::v1::MLModelService::NewStub(channel)->Infer(
+            &ctx, request, &response);
+        BOOST_CHECK(status.error_code() == grpc::StatusCode::FAILED_PRECONDITION);
+        BOOST_CHECK(status.error_message().find(impl::mlmodel::k_shared_memory_unavailable) == 0);
+    });
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(test_batching_mlmodel)
+
+// A model with one float32 input `x` of shape [batch, 3], whose output `y` is double its input.
+std::shared_ptr<MockMLModelService> make_doubling_model(int batch_dimension,
+                                                        std::vector<std::size_t>* batch_rows) {
+    const struct MLModelService::tensor_info x {
+        "x", "", MLModelService::tensor_info::data_types::k_float32, {batch_dimension, 3}, {}, {}
+    };
+    const struct MLModelService::tensor_info y {
+        "y", "", MLModelService::tensor_info::data_types::k_float32, {batch_dimension, 3}, {}, {}
+    };
+
+    auto mock = std::make_shared<MockMLModelService>();
+    mock->set_metadata({"doubler", "", "", {x}, {y}});
+    mock->set_infer_handler([batch_rows](const MLModelService::named_tensor_views& request) {
+        const auto& input = boost::get<MLModelService::tensor_view<float>>(request.at("x"));
+        if (batch_rows) {
+            batch_rows->push_back(input.shape()[0]);
+        }
+
+        struct doubled {
+            std::vector<float> data;
+            MLModelService::named_tensor_views views;
+        };
+        auto result = std::make_shared<doubled>();
+        for (const float value : input) {
+            result->data.push_back(value * 2);
+        }
+        result->views.emplace("y",
+                              MLModelService::make_tensor_view(
+                                  result->data.data(), result->data.size(), {input.shape()[0], 3}));
+        auto* const views = &result->views;
+        return std::shared_ptr<MLModelService::named_tensor_views>(std::move(result), views);
+    });
+    return mock;
+}
+
+// Runs one row through `model` on each of `callers` threads at once, and returns the outputs.
+std::vector<std::vector<float>> infer_concurrently(MLModelService& model, int callers) {
+    std::vector<std::future<std::vector<float>>> pending;
+    for (int i = 0; i < callers; ++i) {
+        pending.push_back(std::async(std::launch::async, [&model, i] {
+            const std::vector<float> row = {float(i), float(i) + 0.5F, float(i) + 0.25F};
+            MLModelService::named_tensor_views request;
+            request.emplace("x", MLModelService::make_tensor_view(row.data(), row.size(), {1, 3}));
+            const auto response = model.infer(request);
+            const auto& output = boost::get<MLModelService::tensor_view<float>>(response->at("y"));
+            BOOST_TEST(output.shape()[0] == 1);
+            return std::vector<float>(output.begin(), output.end());
+        }));
+    }
+
+    std::vector<std::vector<float>> outputs;
+    for (auto& output : pending) {
+        outputs.push_back(output.get());
+    }
+    return outputs;
+}
+
+double batching_stat(MLModelService& model, const std::string& key) {
+    const ProtoStruct status = model.get_status();
+    return status.at("batching").get_unchecked<ProtoStruct>().at(key).get_unchecked<double>();
+}
+
+BOOST_AUTO_TEST_CASE(test_batches_concurrent_calls) {
+    std::vector<std::size_t> batch_rows;
+    BatchingMLModelService batching(
+        "batching", make_doubling_model(-1, &batch_rows), {4, std::chrono::seconds(5)});
+
+    const auto outputs = infer_concurrently(batching, 4);
+    for (int i = 0; i < 4; ++i) {
+        const std::vector<float> expected = {2.0F * i, 2.0F * i + 1, 2.0F * i + 0.5F};
+        BOOST_TEST(outputs[i] == expected, boost::test_tools::per_element());
+    }
+
+    // The batch filled up, so it ran without waiting out the queue delay.
+    BOOST_REQUIRE_EQUAL(batch_rows.size(), 1);
+    BOOST_TEST(batch_rows[0] == 4);
+    BOOST_TEST(batching_stat(batching, "batches") == 1);
+    BOOST_TEST(batching_stat(batching, "largest_batch_size") == 4);
+    BOOST_TEST(batching_stat(batching, "mean_batch_size") == 4);
+}
+
+BOOST_AUTO_TEST_CASE(test_fixed_batch_dimension_is_not_batched) {
+    std::vector<std::size_t> batch_rows;
+    BatchingMLModelService batching(
+        "batching", make_doubling_model(1, &batch_rows), {4, std::chrono::seconds(5)});
+
+    const auto outputs = infer_concurrently(batching, 1);
+    BOOST_TEST(outputs[0][1] == 1.0F);
+    BOOST_TEST(batching_stat(batching, "unbatched_requests") == 1);
+    BOOST_TEST(batching_stat(batching, "batches") == 0);
+}
+
+BOOST_AUTO_TEST_CASE(test_batch_error_reaches_every_caller) {
+    auto mock = make_doubling_model(-1, nullptr);
+    mock->set_infer_handler([](const MLModelService::named_tensor_views&)
+                                -> std::shared_ptr<MLModelService::named_tensor_views> {
+        throw Exception("inference failed");
+    });
+    BatchingMLModelService batching("batching", mock, {2, std::chrono::seconds(5)});
+
+    BOOST_CHECK_THROW(infer_concurrently(batching, 2), Exception);
+    BOOST_TEST(batching_stat(batching, "batches") == 1);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(test_tensor_ops)
+
+BOOST_AUTO_TEST_CASE(test_hwc_to_chw) {
+    // Two images of 2 x 3 pixels with 2 channels, whose elements count up from zero.
+    std::vector<std::uint16_t> data(2 * 2 * 3 * 2);
+    std::iota(data.begin(), data.end(), 0);
+    const auto input = MLModelService::make_tensor_view(data.data(), data.size(), {2, 2, 3, 2});
+
+    std::vector<std::uint16_t> output(data.size());
+    const auto result = tensor_ops::hwc_to_chw(input, output.data(), output.size());
+    BOOST_TEST(result.shape() == std::vector<std::size_t>({2, 2, 2, 3}),
+               boost::test_tools::per_element());
+
+    const std::vector<std::uint16_t> expected = {
+        0, 2, 4, 6, 8, 10, 1, 3, 5, 7, 9, 11, 12, 14, 16, 18, 20, 22, 13, 15, 17, 19, 21, 23};
+    BOOST_TEST(output == expected, boost::test_tools::per_element());
+
+    // The overload over `tensor_views` checks the size of the output buffer in bytes.
+    std::vector<std::uint16_t> too_small(data.size() - 1);
+    BOOST_CHECK_THROW(tensor_ops::hwc_to_chw(MLModelService::tensor_views{input},
+                                             too_small.data(),
+                                             too_small.size() * sizeof(std::uint16_t)),
+                      Exception);
+}
+
+BOOST_AUTO_TEST_CASE(test_normalize) {
+    const std::vector<std::uint8_t> data = {0, 51, 102, 153, 204, 255};
+    const auto input = MLModelService::make_tensor_view(data.data(), data.size(), {1, 2, 3});
+
+    tensor_ops::normalization norm;
+    norm.scale = 1.0F / 255;
+    norm.mean = {0.0F, 0.5F, 1.0F};
+    norm.stddev = {1.0F, 0.5F, 0.25F};
+
+    std::vector<float> output(data.size());
+    tensor_ops::normalize(
+        input, norm, tensor_ops::layout::k_channels_last, output.data(), output.size());
+    const std::vector<float> expected_hwc = {0.0F, -0.6F, -2.4F, 0.6F, 0.6F, 0.0F};
+    for (std::size_t i = 0; i < output.size(); ++i) {
+        BOOST_TEST(std::abs(output[i] - expected_hwc[i]) < 1e-5F);
+    }
+
+    const auto chw = tensor_ops::normalize(
+        input, norm, tensor_ops::layout::k_channels_first, output.data(), output.size());
+    BOOST_TEST(chw.shape() == std::vector<std::size_t>({3, 1, 2}),
+               boost::test_tools::per_element());
+    const std::vector<float> expected_chw = {0.0F, 0.6F, -0.6F, 0.6F, -2.4F, 0.0F};
+    for (std::size_t i = 0; i < output.size(); ++i) {
+        BOOST_TEST(std::abs(output[i] - expected_chw[i]) < 1e-5F);
+    }
+
+    norm.mean = {0.0F, 0.0F};
+    BOOST_CHECK_THROW(
+        tensor_ops::normalize(
+            input, norm, tensor_ops::layout::k_channels_last, output.data(), output.size()),
+        Exception);
+}
+
+BOOST_AUTO_TEST_CASE(test_normalize_in_parallel) {
+    // Large enough to be split across threads, with a row length which is not a multiple of the
+    // coefficient tile.
+    const std::size_t height = 97;
+    const std::size_t width = 131;
+    std::vector<std::uint8_t> data(height * width * 3);
+    for (std::size_t i = 0; i < data.size(); ++i) {
+        data[i] = static_cast<std::uint8_t>(i * 7);
+    }
+    const auto input =
+        MLModelService::make_tensor_view(data.data(), data.size(), {height, width, 3});
+
+    tensor_ops::normalization norm;
+    norm.mean = {1.0F, 2.0F, 3.0F};
+    norm.stddev = {2.0F};
+
+    tensor_ops::execution serial;
+    serial.max_threads = 1;
+    tensor_ops::execution parallel;
+    parallel.max_threads = 4;
+    parallel.min_elements_per_thread = 1024;
+
+    for (const auto l :
+         {tensor_ops::layout::k_channels_last, tensor_ops::layout::k_channels_first}) {
+        std::vector<float> expected(data.size());
+        std::vector<float> output(data.size());
+        tensor_ops::normalize(input, norm, l, expected.data(), expected.size(), serial);
+        tensor_ops::normalize(input, norm, l, output.data(), output.size(), parallel);
+        BOOST_TEST(output == expected, boost::test_tools::per_element());
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_quantize_round_trip) {
+    const std::vector<float> data = {-1.0F, -0.26F, 0.0F, 0.24F, 1000.0F, -1000.0F};
+    const auto input = MLModelService::make_tensor_view(data.data(), data.size(), {2, 3});
+    const tensor_ops::quantization params{0.5F, -3};
+
+    std::vector<std::int8_t> quantized(data.size());
+    const auto q = tensor_ops::quantize(input, params, quantized.data(), quantized.size());
+    BOOST_TEST(q.shape() == std::vector<std::size_t>({2, 3}), boost::test_tools::per_element());
+    const std::vector<std::int8_t> expected = {-5, -4, -3, -3, 127, -128};
+    BOOST_TEST(quantized == expected, boost::test_tools::per_element());
+
+    std::vector<float> dequantized(data.size());
+    tensor_ops::dequantize(q, params, dequantized.data(), dequantized.size());
+    const std::vector<float> expected_real = {-1.0F, -0.5F, 0.0F, 0.0F, 65.0F, -62.5F};
+    BOOST_TEST(dequantized == expected_real, boost::test_tools::per_element());
+
+    std::vector<std::uint8_t> unsigned_quantized(data.size());
+    tensor_ops::quantize(
+        input, {0.5F, 128}, unsigned_quantized.data(), unsigned_quantized.size());
+    const std::vector<std::uint8_t> expected_unsigned = {126, 127, 128, 128, 255, 0};
+    BOOST_TEST(unsigned_quantized == expected_unsigned, boost::test_tools::per_element());
+}
+
+BOOST_AUTO_TEST_CASE(test_letterbox_resize) {
+    // A 2 x 4 image with one channel, fit into 4 x 4: it keeps its size and is padded above and
+    // below.
+    const std::vector<std::uint8_t> data = {10, 20, 30, 40, 50, 60, 70, 80};
+    const auto input = MLModelService::make_tensor_view(data.data(), data.size(), {1, 2, 4, 1});
+
+    std::vector<std::uint8_t> output(16);
+    tensor_ops::letterbox placement;
+    const auto result =
+        tensor_ops::letterbox_resize(input, 4, 4, 0, output.data(), output.size(), &placement);
+    BOOST_TEST(result.shape() == std::vector<std::size_t>({1, 4, 4, 1}),
+               boost::test_tools::per_element());
+    BOOST_TEST(placement.scale == 1.0F);
+    BOOST_TEST(placement.top == 1U);
+    BOOST_TEST(placement.left == 0U);
+    BOOST_TEST(placement.height == 2U);
+    BOOST_TEST(placement.width == 4U);
+    const std::vector<std::uint8_t> expected = {
+        0, 0, 0, 0, 10, 20, 30, 40, 50, 60, 70, 80, 0, 0, 0, 0};
+    BOOST_TEST(output == expected, boost::test_tools::per_element());
+
+    // Shrinking a 2 x 4 image into 2 x 2 halves it, averaging each 2 x 2 block, and pads below.
+    const auto image = MLModelService::make_tensor_view(data.data(), data.size(), {2, 4, 1});
+    std::vector<std::uint8_t> shrunk(2 * 2);
+    tensor_ops::letterbox_resize(image, 2, 2, 255, shrunk.data(), shrunk.size(), &placement);
+    BOOST_TEST(placement.scale == 0.5F);
+    BOOST_TEST(placement.top == 0U);
+    BOOST_TEST(placement.height == 1U);
+    const std::vector<std::uint8_t> expected_shrunk = {35, 55, 255, 255};
+    BOOST_TEST(shrunk == expected_shrunk, boost::test_tools::per_element());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
 // This test suite is to validate that we can use xtensor for all of
 // the tensor data shuttling we need.
 BOOST_AUTO_TEST_SUITE(xtensor_experiment)
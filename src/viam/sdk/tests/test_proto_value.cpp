@@ -1,9 +1,14 @@
 #define BOOST_TEST_MODULE test module test_proto_value
 #include <viam/sdk/common/proto_value.hpp>
 
+#include <algorithm>
+#include <iterator>
 #include <memory>
+#include <type_traits>
 #include <unordered_map>
+#include <utility>
 
+#include <google/protobuf/arena.h>
 #include <google/protobuf/struct.pb.h>
 
 #include <boost/mp11/algorithm.hpp>
@@ -11,6 +16,10 @@
 #include <boost/mp11/tuple.hpp>
 #include <boost/test/included/unit_test.hpp>
 
+#include <viam/sdk/common/flat_proto_struct.hpp>
+#include <viam/sdk/common/private/proto_value.hpp>
+#include <viam/sdk/common/proto_struct_view.hpp>
+#include <viam/sdk/common/proto_value_visit.hpp>
 #include <viam/sdk/config/resource.hpp>
 #include <viam/sdk/tests/test_utils.hpp>
 
@@ -332,6 +341,229 @@ BOOST_AUTO_TEST_CASE(test_manual_map_conversion) {
     });
 }
 
+BOOST_AUTO_TEST_CASE(test_flat_struct) {
+    const ProtoStruct map{{"zeta", 1.0},
+                          {"alpha", "str"},
+                          {"mid", ProtoList({ProtoValue{true}, ProtoValue{2.0}})},
+                          {"nested", ProtoStruct{{"x", 1.0}}},
+                          {"null", nullptr},
+                          {"beta", false}};
+
+    FlatProtoStruct flat(map);
+    BOOST_CHECK_EQUAL(flat.size(), map.size());
+    BOOST_CHECK(std::is_sorted(flat.begin(), flat.end(), [](const auto& lhs, const auto& rhs) {
+        return lhs.first < rhs.first;
+    }));
+
+    for (const auto& kv : map) {
+        BOOST_CHECK(flat.at(kv.first) == kv.second);
+    }
+    BOOST_CHECK(flat.find("missing") == flat.end());
+    BOOST_CHECK_EQUAL(flat.count("alpha"), 1);
+    BOOST_CHECK_THROW(flat.at("missing"), std::out_of_range);
+
+    // Conversions agree with those of ProtoStruct in both directions.
+    const google::protobuf::Struct proto = to_proto(flat);
+    BOOST_CHECK(from_proto(proto) == map);
+    BOOST_CHECK(proto.ShortDebugString() == to_proto(map).ShortDebugString());
+    BOOST_CHECK(flat.to_proto_struct() == map);
+
+    FlatProtoStruct from_struct;
+    from_struct.assign(proto);
+    BOOST_CHECK(from_struct == flat);
+
+    // The mapped values are ProtoValues, so they can be visited directly.
+    std::size_t strings = 0;
+    for (const auto& entry : flat) {
+        visit(
+            [&](const auto& value) {
+                strings += std::is_same<std::decay_t<decltype(value)>, std::string>{};
+            },
+            entry.second);
+    }
+    BOOST_CHECK_EQUAL(strings, 1);
+
+    // The first entry for a key wins, as with ProtoStruct.
+    const FlatProtoStruct dupes{{"b", 1.0}, {"a", 2.0}, {"b", 3.0}};
+    BOOST_CHECK_EQUAL(dupes.size(), 2);
+    BOOST_CHECK(dupes.at("b") == ProtoValue(1.0));
+
+    FlatProtoStruct modified = dupes;
+    BOOST_CHECK(!modified.emplace("a", 5.0).second);
+    BOOST_CHECK(modified.at("a") == ProtoValue(2.0));
+    BOOST_CHECK(!modified.insert_or_assign("a", 5.0).second);
+    BOOST_CHECK(modified.at("a") == ProtoValue(5.0));
+    BOOST_CHECK(modified.emplace("c", "new").second);
+    modified["d"] = true;
+    BOOST_CHECK(modified.at("d") == ProtoValue(true));
+    BOOST_CHECK_EQUAL(modified.erase("b"), 1);
+    BOOST_CHECK_EQUAL(modified.erase("b"), 0);
+    BOOST_CHECK(modified == FlatProtoStruct({{"a", 5.0}, {"c", "new"}, {"d", true}}));
+    BOOST_CHECK(modified != dupes);
+
+    // Clearing keeps the entry storage for reuse.
+    const std::size_t capacity = flat.capacity();
+    flat.clear();
+    BOOST_CHECK(flat.empty());
+    BOOST_CHECK_EQUAL(flat.capacity(), capacity);
+}
+
+BOOST_AUTO_TEST_CASE(test_flat_struct_iterators_keep_keys_const) {
+    // Changing a key through an iterator would break the order that lookup relies on, so only
+    // values can be modified, as with std::map.
+    using iterator = FlatProtoStruct::iterator;
+    using const_iterator = FlatProtoStruct::const_iterator;
+    static_assert(!std::is_assignable<decltype((std::declval<iterator>()->first)), std::string>{},
+                  "keys must not be assignable through an iterator");
+    static_assert(!std::is_assignable<decltype(((*std::declval<iterator>()).first)), std::string>{},
+                  "keys must not be assignable through an iterator");
+    static_assert(std::is_assignable<decltype((std::declval<iterator>()->second)), ProtoValue>{},
+                  "values must be assignable through an iterator");
+    static_assert(
+        !std::is_assignable<decltype((std::declval<const_iterator>()->second)), ProtoValue>{},
+        "values must not be assignable through a const_iterator");
+    static_assert(std::is_convertible<iterator, const_iterator>{},
+                  "an iterator must convert to a const_iterator");
+
+    FlatProtoStruct flat{{"b", 1.0}, {"a", 2.0}};
+    for (auto entry : flat) {
+        entry.second = entry.first;
+    }
+    flat.find("a")->second = 3.0;
+    BOOST_CHECK(flat == FlatProtoStruct({{"a", 3.0}, {"b", "b"}}));
+
+    const FlatProtoStruct::value_type copied = *flat.begin();
+    BOOST_CHECK_EQUAL(copied.first, "a");
+    BOOST_CHECK(copied.second == ProtoValue(3.0));
+
+    const FlatProtoStruct::const_iterator first = flat.begin();
+    BOOST_CHECK(first == flat.cbegin());
+    BOOST_CHECK_EQUAL(std::distance(first, flat.cend()), 2);
+    BOOST_CHECK(flat.erase(first) == flat.find("b"));
+}
+
+BOOST_AUTO_TEST_CASE(test_move_and_arena_conversion) {
+    const ProtoList list{ProtoValue{"x"}, ProtoValue{ProtoStruct{{"y", true}}}};
+    const ProtoStruct map{{"str", "a string long enough to be heap allocated"},
+                          {"num", 2.5},
+                          {"null", nullptr},
+                          {"list", list},
+                          {"nested", ProtoStruct{{"inner", ProtoList({ProtoValue{1.0}})}}}};
+
+    const google::protobuf::Struct proto = to_proto(map);
+
+    {
+        google::protobuf::Struct moved_from = proto;
+        BOOST_CHECK(from_proto(std::move(moved_from)) == map);
+    }
+
+    {
+        google::protobuf::Value moved_from;
+        *moved_from.mutable_struct_value() = proto;
+        BOOST_CHECK(from_proto(std::move(moved_from)) == ProtoValue(map));
+    }
+
+    {
+        google::protobuf::Arena arena;
+        google::protobuf::Struct* on_arena = to_proto(map, &arena);
+        BOOST_CHECK(on_arena->GetArena() == &arena);
+        BOOST_CHECK(on_arena->fields().at("nested").struct_value().GetArena() == &arena);
+        BOOST_CHECK(from_proto(*on_arena) == map);
+        BOOST_CHECK(from_proto(std::move(*on_arena)) == map);
+
+        google::protobuf::Value* value_on_arena = to_proto(ProtoValue(map), &arena);
+        BOOST_CHECK(value_on_arena->GetArena() == &arena);
+        BOOST_CHECK(from_proto(*value_on_arena) == ProtoValue(map));
+    }
+
+    {
+        // Writing straight into a map of fields matches going through a Struct.
+        impl::proto_field_map fields;
+        impl::to_proto_fields(map, &fields);
+        BOOST_CHECK_EQUAL(fields.size(), map.size());
+        for (const auto& kv : map) {
+            BOOST_CHECK(from_proto(fields.at(kv.first)) == kv.second);
+        }
+        BOOST_CHECK(impl::from_proto_fields(std::move(fields)) == map);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_struct_view) {
+    const ProtoStruct map{{"flag", true},
+                          {"num", 2.5},
+                          {"str", "value"},
+                          {"null", nullptr},
+                          {"list", ProtoList({ProtoValue{1.0}})},
+                          {"nested", ProtoStruct{{"inner", "x"}}}};
+    const google::protobuf::Struct proto = to_proto(map);
+    const ProtoStructView view(proto);
+
+    BOOST_CHECK(!view.empty());
+    BOOST_CHECK_EQUAL(view.size(), map.size());
+    BOOST_CHECK(view.contains("flag"));
+    BOOST_CHECK(!view.contains("missing"));
+
+    for (const auto& kv : map) {
+        BOOST_CHECK(view.kind(kv.first) == kv.second.kind());
+        BOOST_CHECK(*view.get(kv.first) == kv.second);
+    }
+    BOOST_CHECK(!view.kind("missing"));
+    BOOST_CHECK(!view.get("missing"));
+
+    BOOST_CHECK(view.get_bool("flag") == true);
+    BOOST_CHECK(!view.get_bool("num"));
+    BOOST_CHECK(view.get_double("num") == 2.5);
+    BOOST_CHECK(!view.get_double("missing"));
+
+    // Strings are read in place.
+    BOOST_REQUIRE(view.get_string("str"));
+    BOOST_CHECK(view.get_string("str") == &proto.fields().at("str").string_value());
+    BOOST_CHECK(!view.get_string("flag"));
+
+    const auto nested = view.get_struct("nested");
+    BOOST_REQUIRE(nested);
+    BOOST_CHECK_EQUAL(*nested->get_string("inner"), "x");
+    BOOST_CHECK(!view.get_struct("list"));
+
+    std::size_t visited = 0;
+    view.for_each([&](const std::string& key, const google::protobuf::Value& value) {
+        BOOST_CHECK(from_proto(value) == map.at(key));
+        ++visited;
+    });
+    BOOST_CHECK_EQUAL(visited, map.size());
+
+    BOOST_CHECK(view.to_proto_struct() == map);
+
+    const ProtoStructView empty;
+    BOOST_CHECK(empty.empty());
+    BOOST_CHECK_EQUAL(empty.size(), 0);
+    BOOST_CHECK(!empty.contains("flag"));
+    BOOST_CHECK(empty.to_proto_struct().empty());
+    BOOST_CHECK(ProtoStructView(nullptr).empty());
+}
+
+BOOST_AUTO_TEST_CASE(test_struct_view_many_fields) {
+    // Large structs are searched by hashing rather than by comparing every key.
+    ProtoStruct map;
+    for (int i = 0; i < 100; ++i) {
+        map.emplace("key" + std::to_string(i), static_cast<double>(i));
+    }
+    const google::protobuf::Struct proto = to_proto(map);
+    const ProtoStructView view(proto);
+
+    BOOST_CHECK_EQUAL(view.size(), map.size());
+    for (const auto& kv : map) {
+        BOOST_CHECK(view.get_double(kv.first) == kv.second.get_unchecked<double>());
+    }
+    BOOST_CHECK(view.contains("key99"));
+    BOOST_CHECK(!view.contains("key100"));
+
+    // Keys need not be null-terminated.
+    const std::string key = "key42";
+    BOOST_CHECK(view.get_double(boost::string_view(key).substr(0, 3)) == boost::none);
+    BOOST_CHECK(view.get_double(boost::string_view(key)) == 42.0);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 }  // namespace sdktests
@@ -1,6 +1,11 @@
 #define BOOST_TEST_MODULE test module test_resource
 #include <boost/test/included/unit_test.hpp>
 
+#include <atomic>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
 #include <google/protobuf/struct.pb.h>
 
 #include <viam/api/app/v1/robot.pb.h>
@@ -12,9 +17,12 @@
 #include <viam/sdk/config/resource.hpp>
 #include <viam/sdk/referenceframe/frame.hpp>
 #include <viam/sdk/resource/resource_api.hpp>
+#include <viam/sdk/resource/resource_manager.hpp>
 #include <viam/sdk/spatialmath/geometry.hpp>
 #include <viam/sdk/spatialmath/orientation.hpp>
 #include <viam/sdk/spatialmath/orientation_types.hpp>
+#include <viam/sdk/tests/mocks/mock_sensor.hpp>
+#include <viam/sdk/tests/test_utils.hpp>
 
 BOOST_TEST_DONT_PRINT_LOG_VALUE(viam::sdk::GeometryType);
 
@@ -74,6 +82,38 @@ BOOST_AUTO_TEST_CASE(test_name) {
     BOOST_CHECK_THROW(Name::from_string("ns:service:#st/remote:name"), Exception);
 }
 
+BOOST_AUTO_TEST_CASE(test_name_hash_and_equality) {
+    const API api = API::from_string("ns:component:st");
+    const API same_api("ns", "component", "st");
+    BOOST_CHECK_EQUAL(api, same_api);
+    BOOST_CHECK_EQUAL(api.hash(), same_api.hash());
+    BOOST_CHECK_EQUAL(&api.type_namespace(), &same_api.type_namespace());
+    BOOST_CHECK(!(api == API("ns", "component", "other")));
+
+    // A remote of ":" is rendered the same as no remote at all, so they must compare equal.
+    const Name local(api, "", "name");
+    const Name colon_remote(api, ":", "name");
+    BOOST_CHECK_EQUAL(local, colon_remote);
+    BOOST_CHECK_EQUAL(local.hash(), colon_remote.hash());
+
+    const Name remote(api, "remote", "name");
+    BOOST_CHECK(!(local == remote));
+    BOOST_CHECK(!(local == Name(API("ns", "service", "st"), "", "name")));
+    BOOST_CHECK_EQUAL(Name(), Name(API(), "", ""));
+
+    std::unordered_map<Name, int> names;
+    names.emplace(local, 1);
+    names.emplace(remote, 2);
+    BOOST_CHECK_EQUAL(names.at(Name::from_string("ns:component:st/name")), 1);
+    BOOST_CHECK_EQUAL(names.at(Name::from_string("ns:component:st/remote:name")), 2);
+
+    const RPCSubtype subtype(api, "viam.component.st.v1.StService");
+    const RPCSubtype same_subtype(same_api, "viam.component.st.v1.StService");
+    BOOST_CHECK(subtype == same_subtype);
+    BOOST_CHECK_EQUAL(std::hash<RPCSubtype>()(subtype), std::hash<RPCSubtype>()(same_subtype));
+    BOOST_CHECK(!(subtype == RPCSubtype(api)));
+}
+
 BOOST_AUTO_TEST_CASE(test_model) {
     ModelFamily mf("ns", "mf");
     BOOST_CHECK_EQUAL(mf.to_string(), "ns:mf");
@@ -268,5 +308,93 @@ BOOST_AUTO_TEST_CASE(test_resource) {
     BOOST_CHECK_THROW(from_proto(proto_cfg), Exception);
 }
 
+BOOST_AUTO_TEST_CASE(test_resource_manager) {
+    ResourceManager manager;
+    const Name local(API::get<Sensor>(), "", "local");
+    const Name remote(API::get<Sensor>(), "remote", "far");
+
+    auto local_sensor = std::make_shared<sensor::MockSensor>("local");
+    auto remote_sensor = std::make_shared<sensor::MockSensor>("remote:far");
+    manager.add(local, local_sensor);
+    manager.add(remote, remote_sensor);
+
+    BOOST_CHECK(manager.resource("local") == local_sensor);
+    BOOST_CHECK(manager.resource("remote:far") == remote_sensor);
+    BOOST_CHECK(manager.resource("far") == remote_sensor);
+    BOOST_CHECK(manager.resource<Sensor>("far") == remote_sensor);
+    BOOST_CHECK(!manager.resource("nonexistent"));
+    BOOST_CHECK_EQUAL(manager.resources().size(), 2);
+
+    auto replacement = std::make_shared<sensor::MockSensor>("local");
+    manager.replace_one(local, [&] { return replacement; });
+    BOOST_CHECK(manager.resource("local") == replacement);
+
+    manager.remove(remote);
+    BOOST_CHECK(!manager.resource("remote:far"));
+    BOOST_CHECK(!manager.resource("far"));
+
+    manager.replace_all({{remote, remote_sensor}});
+    BOOST_CHECK(!manager.resource("local"));
+    BOOST_CHECK(manager.resource("far") == remote_sensor);
+}
+
+BOOST_AUTO_TEST_CASE(test_resource_manager_update) {
+    ResourceManager manager;
+    const Name kept(API::get<Sensor>(), "", "kept");
+    const Name dropped(API::get<Sensor>(), "", "dropped");
+    const Name added(API::get<Sensor>(), "", "added");
+
+    auto kept_sensor = std::make_shared<sensor::MockSensor>("kept");
+    manager.add(kept, kept_sensor);
+    manager.add(dropped, std::make_shared<sensor::MockSensor>("dropped"));
+
+    auto added_sensor = std::make_shared<sensor::MockSensor>("added");
+    const Name never_added(API::get<Sensor>(), "", "never_added");
+    manager.update({dropped, never_added}, {{added, added_sensor}});
+
+    BOOST_CHECK(manager.resource("kept") == kept_sensor);
+    BOOST_CHECK(manager.resource("added") == added_sensor);
+    BOOST_CHECK(!manager.resource("dropped"));
+    BOOST_CHECK_EQUAL(manager.resources().size(), 2);
+}
+
+BOOST_AUTO_TEST_CASE(test_resource_manager_concurrent_lookup) {
+    ResourceManager manager;
+    const Name stable(API::get<Sensor>(), "", "stable");
+    const Name churn(API::get<Sensor>(), "", "churn");
+
+    auto stable_sensor = std::make_shared<sensor::MockSensor>("stable");
+    manager.add(stable, stable_sensor);
+
+    std::atomic<bool> done{false};
+    std::atomic<int> misses{0};
+    std::vector<std::thread> readers;
+    for (int i = 0; i < 4; ++i) {
+        readers.emplace_back([&] {
+            while (!done.load()) {
+                if (manager.resource("stable") != stable_sensor) {
+                    ++misses;
+                }
+                (void)manager.resource("churn");
+            }
+        });
+    }
+
+    for (int i = 0; i < 1000; ++i) {
+        manager.add(churn, std::make_shared<sensor::MockSensor>("churn"));
+        manager.replace_one(churn, [] { return std::make_shared<sensor::MockSensor>("churn"); });
+        manager.remove(churn);
+    }
+
+    done.store(true);
+    for (auto& reader : readers) {
+        reader.join();
+    }
+
+    BOOST_CHECK_EQUAL(misses.load(), 0);
+    BOOST_CHECK(manager.resource("stable") == stable_sensor);
+    BOOST_CHECK(!manager.resource("churn"));
+}
+
 }  // namespace sdktests
 }  // namespace viam
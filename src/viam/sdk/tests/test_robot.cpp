@@ -1,17 +1,34 @@
 #include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <exception>
+#include <future>
 #include <memory>
+#include <mutex>
 #include <ostream>
+#include <string>
+#include <thread>
 #include <typeinfo>
 #include <unordered_set>
 #include <utility>
+#include <vector>
 
 #define BOOST_TEST_MODULE test module test_robot
+#include <boost/optional/optional.hpp>
 #include <boost/test/included/unit_test.hpp>
 
+#include <grpcpp/create_channel.h>
+#include <grpcpp/security/credentials.h>
+#include <grpcpp/security/server_credentials.h>
+#include <grpcpp/server.h>
+#include <grpcpp/server_builder.h>
+
+#include <viam/sdk/common/exception.hpp>
 #include <viam/sdk/common/pose.hpp>
 #include <viam/sdk/common/utils.hpp>
 #include <viam/sdk/components/camera.hpp>
 #include <viam/sdk/components/motor.hpp>
+#include <viam/sdk/robot/private/connection_watcher.hpp>
 #include <viam/sdk/rpc/dial.hpp>
 #include <viam/sdk/tests/mocks/camera_mocks.hpp>
 #include <viam/sdk/tests/mocks/generic_mocks.hpp>
@@ -225,6 +242,261 @@ BOOST_AUTO_TEST_CASE(test_get_resource) {
         });
 }
 
+BOOST_AUTO_TEST_CASE(test_refresh_keeps_unchanged_clients) {
+    robot_client_to_mocks_pipeline(
+        [](std::shared_ptr<RobotClient> client, MockRobotService& service) -> void {
+            const std::shared_ptr<Resource> motor_client = client->resource_by_name(
+                Name(API::get<Motor>(), "", "mock_motor"));
+            BOOST_REQUIRE(motor_client);
+
+            auto& manager = *service.resource_manager();
+            manager.remove(Name(API::get<Camera>(), "", "mock_camera"));
+            manager.add(std::string("mock_motor_2"),
+                        std::make_shared<motor::MockMotor>("mock_motor_2"));
+
+            client->refresh();
+
+            // The new motor has a client, the camera's is gone, and the existing motor keeps the
+            // client it had.
+            BOOST_CHECK(client->resource_by_name<Motor>("mock_motor_2"));
+            BOOST_CHECK(!client->resource_by_name<Camera>("mock_camera"));
+            BOOST_CHECK(client->resource_by_name(Name(API::get<Motor>(), "", "mock_motor")) ==
+                        motor_client);
+            BOOST_CHECK_EQUAL(client->resource_names().size(), 3);
+        });
+}
+
+BOOST_AUTO_TEST_CASE(test_read_resources) {
+    robot_client_to_mocks_pipeline(
+        [](std::shared_ptr<RobotClient> client, MockRobotService& service) -> void {
+            const Name motor_name(API::get<Motor>(), "", "mock_motor");
+            const Name camera_name(API::get<Camera>(), "", "mock_camera");
+            const Name missing_name(API::get<Motor>(), "", "missing_motor");
+
+            auto positions = client->read_resources<Motor>(
+                {motor_name, camera_name, missing_name},
+                std::chrono::seconds(5),
+                [](Motor& motor) { return motor.get_position_async(); });
+
+            BOOST_REQUIRE_EQUAL(positions.size(), 3);
+
+            BOOST_CHECK_EQUAL(positions[0].name, motor_name);
+            BOOST_REQUIRE(positions[0].value);
+            BOOST_CHECK(!positions[0].error);
+            BOOST_CHECK_EQUAL(*positions[0].value,
+                              client->resource_by_name<Motor>("mock_motor")->get_position());
+
+            // Each failure is reported against its own resource.
+            BOOST_CHECK_EQUAL(positions[1].name, camera_name);
+            BOOST_CHECK(!positions[1].value);
+            BOOST_CHECK_THROW(std::rethrow_exception(positions[1].error), Exception);
+            BOOST_CHECK(!positions[2].value);
+            BOOST_CHECK_THROW(std::rethrow_exception(positions[2].error), Exception);
+
+            auto images = client->read_resources<Camera>(
+                {camera_name}, std::chrono::seconds(5), [](Camera& camera) {
+                    return camera.get_images_async();
+                });
+            BOOST_REQUIRE(images[0].value);
+            BOOST_CHECK(*images[0].value == camera::fake_raw_images());
+            BOOST_CHECK(images[0].latency > std::chrono::microseconds(0));
+        });
+}
+
+BOOST_AUTO_TEST_CASE(test_read_resources_deadline) {
+    robot_client_to_mocks_pipeline(
+        [](std::shared_ptr<RobotClient> client, MockRobotService& service) -> void {
+            const Name motor_name(API::get<Motor>(), "", "mock_motor");
+
+            // A zero timeout expires the calls' deadline before they can complete.
+            auto positions = client->read_resources<Motor>(
+                {motor_name}, std::chrono::milliseconds(0), [](Motor& motor) {
+                    return motor.get_position_async();
+                });
+
+            BOOST_REQUIRE_EQUAL(positions.size(), 1);
+            BOOST_CHECK(!positions[0].value);
+            BOOST_CHECK(positions[0].error);
+        });
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(test_connection_watcher)
+
+using sdk::impl::ConnectionWatcher;
+using namespace std::chrono_literals;
+
+// A channel which is never asked to connect, so that its state stays IDLE.
+std::shared_ptr<grpc::Channel> idle_channel() {
+    return grpc::CreateChannel("localhost:1", grpc::InsecureChannelCredentials());
+}
+
+template <typename Predicate>
+bool wait_until(Predicate&& predicate, std::chrono::milliseconds timeout) {
+    const auto deadline = std::chrono::steady_clock::now() + timeout;
+    while (!predicate()) {
+        if (std::chrono::steady_clock::now() >= deadline) {
+            return false;
+        }
+        std::this_thread::sleep_for(5ms);
+    }
+    return true;
+}
+
+BOOST_AUTO_TEST_CASE(test_reconnect_backoff_and_give_up) {
+    std::mutex lock;
+    std::vector<std::chrono::steady_clock::time_point> attempts;
+    std::atomic<int> give_ups{0};
+    std::promise<void> gave_up;
+
+    ConnectionWatcher::watch_options options;
+    options.name = "test_reconnect_backoff_and_give_up";
+    options.keepalive_interval = 10ms;
+    options.keepalive = [] { return false; };
+    options.reconnect_interval = 20ms;
+    options.reconnect = [&]() -> std::shared_ptr<grpc::Channel> {
+        const std::lock_guard<std::mutex> guard(lock);
+        attempts.push_back(std::chrono::steady_clock::now());
+        return nullptr;
+    };
+    options.max_reconnect_attempts = 4;
+    options.on_give_up = [&] {
+        if (++give_ups == 1) {
+            gave_up.set_value();
+        }
+    };
+
+    auto& watcher = ConnectionWatcher::get();
+    const auto id = watcher.watch(idle_channel(), std::move(options));
+    BOOST_REQUIRE(gave_up.get_future().wait_for(10s) == std::future_status::ready);
+    BOOST_CHECK(!watcher.connected(id));
+
+    // Nothing more is attempted once the watch has given up.
+    std::this_thread::sleep_for(100ms);
+    watcher.unwatch(id);
+
+    const std::lock_guard<std::mutex> guard(lock);
+    BOOST_CHECK_EQUAL(give_ups.load(), 1);
+    BOOST_REQUIRE_EQUAL(attempts.size(), 4);
+    for (std::size_t i = 1; i < attempts.size(); ++i) {
+        BOOST_CHECK(attempts[i] - attempts[i - 1] >= 20ms * (1 << (i - 1)));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_failed_channel_gets_reconnect_interval_to_recover) {
+    // Nothing listens on this port, so the channel goes into TRANSIENT_FAILURE once it tries to
+    // connect, and stays there.
+    const auto channel = idle_channel();
+
+    std::mutex lock;
+    boost::optional<std::chrono::steady_clock::time_point> attempted_at;
+    std::promise<void> gave_up;
+
+    ConnectionWatcher::watch_options options;
+    options.name = "test_failed_channel_gets_reconnect_interval_to_recover";
+    options.reconnect_interval = 500ms;
+    options.reconnect = [&]() -> std::shared_ptr<grpc::Channel> {
+        const std::lock_guard<std::mutex> guard(lock);
+        attempted_at = std::chrono::steady_clock::now();
+        return nullptr;
+    };
+    options.max_reconnect_attempts = 1;
+    options.on_give_up = [&] { gave_up.set_value(); };
+
+    auto& watcher = ConnectionWatcher::get();
+    const auto id = watcher.watch(channel, std::move(options));
+    channel->GetState(true);
+    BOOST_REQUIRE(wait_until(
+        [&] { return channel->GetState(false) == GRPC_CHANNEL_TRANSIENT_FAILURE; }, 5s));
+    const auto failed_at = std::chrono::steady_clock::now();
+
+    // gRPC is left to recover the channel for the reconnect interval before it is redialed.
+    std::this_thread::sleep_for(200ms);
+    BOOST_CHECK(watcher.connected(id));
+    BOOST_REQUIRE(gave_up.get_future().wait_for(10s) == std::future_status::ready);
+    watcher.unwatch(id);
+
+    const std::lock_guard<std::mutex> guard(lock);
+    BOOST_REQUIRE(attempted_at);
+    BOOST_CHECK(*attempted_at - failed_at >= 400ms);
+}
+
+BOOST_AUTO_TEST_CASE(test_unwatch_waits_for_probe) {
+    std::promise<void> started;
+    std::promise<void> release;
+    const std::shared_future<void> released = release.get_future().share();
+    std::atomic<int> probes{0};
+
+    ConnectionWatcher::watch_options options;
+    options.name = "test_unwatch_waits_for_probe";
+    options.keepalive_interval = 10ms;
+    options.keepalive = [&] {
+        if (++probes == 1) {
+            started.set_value();
+            released.wait();
+        }
+        return true;
+    };
+
+    auto& watcher = ConnectionWatcher::get();
+    const auto id = watcher.watch(idle_channel(), std::move(options));
+    BOOST_REQUIRE(started.get_future().wait_for(10s) == std::future_status::ready);
+
+    // Both calls wait for the probe in flight, including the one which finds that the other has
+    // already begun ending the watch.
+    auto first = std::async(std::launch::async, [&] { watcher.unwatch(id); });
+    auto second = std::async(std::launch::async, [&] { watcher.unwatch(id); });
+    BOOST_CHECK(first.wait_for(100ms) == std::future_status::timeout);
+    BOOST_CHECK(second.wait_for(100ms) == std::future_status::timeout);
+
+    release.set_value();
+    first.get();
+    second.get();
+    BOOST_CHECK(!watcher.connected(id));
+
+    const int after_unwatch = probes.load();
+    std::this_thread::sleep_for(50ms);
+    BOOST_CHECK_EQUAL(probes.load(), after_unwatch);
+}
+
+BOOST_AUTO_TEST_CASE(test_restores_ready_connection) {
+    int port = 0;
+    grpc::ServerBuilder builder;
+    builder.AddListeningPort("localhost:0", grpc::InsecureServerCredentials(), &port);
+    const std::unique_ptr<grpc::Server> server = builder.BuildAndStart();
+    BOOST_REQUIRE(server);
+    const auto channel = grpc::CreateChannel("localhost:" + std::to_string(port),
+                                             grpc::InsecureChannelCredentials());
+
+    std::promise<void> failed;
+    std::atomic<int> probes{0};
+
+    ConnectionWatcher::watch_options options;
+    options.name = "test_restores_ready_connection";
+    options.keepalive_interval = 1s;
+    options.keepalive = [&] {
+        if (++probes == 1) {
+            failed.set_value();
+        }
+        return false;
+    };
+
+    auto& watcher = ConnectionWatcher::get();
+    const auto id = watcher.watch(channel, std::move(options));
+    BOOST_REQUIRE(failed.get_future().wait_for(10s) == std::future_status::ready);
+    BOOST_REQUIRE(wait_until([&] { return !watcher.connected(id); }, 500ms));
+
+    // Without reconnects, the watch recovers once gRPC brings the channel to READY, well before
+    // the next probe.
+    channel->GetState(true);
+    BOOST_CHECK(wait_until([&] { return watcher.connected(id); }, 800ms));
+    BOOST_CHECK_EQUAL(probes.load(), 1);
+
+    watcher.unwatch(id);
+    server->Shutdown();
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 }  // namespace robot
@@ -1,4 +1,8 @@
 #define BOOST_TEST_MODULE test module test_sensor
+#include <chrono>
+#include <future>
+#include <memory>
+#include <stdexcept>
 #include <typeinfo>
 #include <unordered_map>
 #include <utility>
@@ -7,8 +11,11 @@
 #include <boost/qvm/all.hpp>
 #include <boost/test/included/unit_test.hpp>
 
+#include <viam/sdk/common/exception.hpp>
 #include <viam/sdk/common/proto_value.hpp>
 #include <viam/sdk/components/sensor.hpp>
+#include <viam/sdk/registry/registry.hpp>
+#include <viam/sdk/rpc/dial.hpp>
 #include <viam/sdk/spatialmath/geometry.hpp>
 #include <viam/sdk/tests/mocks/mock_sensor.hpp>
 #include <viam/sdk/tests/test_utils.hpp>
@@ -44,6 +51,79 @@ BOOST_AUTO_TEST_CASE(test_get_readings) {
     });
 }
 
+BOOST_AUTO_TEST_CASE(mock_get_readings_async) {
+    MockSensor sensor("mock_sensor");
+    std::future<ProtoStruct> readings = sensor.get_readings_async();
+
+    BOOST_CHECK(readings.wait_for(std::chrono::seconds(0)) == std::future_status::ready);
+    BOOST_CHECK(readings.get().at("test") == fake_map().at("test"));
+}
+
+BOOST_AUTO_TEST_CASE(test_get_readings_async) {
+    std::shared_ptr<MockSensor> mock = MockSensor::get_mock_sensor();
+    client_to_mock_pipeline<Sensor>(mock, [](Sensor& client) {
+        ProtoStruct expected = fake_map();
+
+        std::vector<std::future<ProtoStruct>> pending;
+        for (int i = 0; i < 12; ++i) {
+            pending.push_back(client.get_readings_async());
+        }
+
+        for (auto& readings : pending) {
+            BOOST_CHECK(readings.get().at("test") == expected.at("test"));
+        }
+    });
+}
+
+BOOST_AUTO_TEST_CASE(test_get_readings_async_error) {
+    class FailingSensor : public MockSensor {
+       public:
+        FailingSensor() : MockSensor("failing_sensor") {}
+
+        ProtoStruct get_readings(const ProtoStruct&) override {
+            throw std::runtime_error("sensor unplugged");
+        }
+    };
+
+    client_to_mock_pipeline<Sensor>(std::make_shared<FailingSensor>(), [](Sensor& client) {
+        std::future<ProtoStruct> readings = client.get_readings_async();
+        BOOST_CHECK_THROW(readings.get(), GRPCException);
+    });
+}
+
+BOOST_AUTO_TEST_CASE(test_get_readings_async_outlives_client) {
+    class BlockingSensor : public MockSensor {
+       public:
+        explicit BlockingSensor(std::shared_future<void> release)
+            : MockSensor("blocking_sensor"), release_(std::move(release)) {}
+
+        ProtoStruct get_readings(const ProtoStruct& extra) override {
+            release_.wait();
+            return MockSensor::get_readings(extra);
+        }
+
+       private:
+        std::shared_future<void> release_;
+    };
+
+    std::promise<void> release;
+    auto mock = std::make_shared<BlockingSensor>(release.get_future().share());
+    channel_to_mock_pipeline(mock, [&](std::shared_ptr<grpc::Channel> grpc_channel) {
+        const ViamChannel channel(std::move(grpc_channel));
+        auto client = Registry::get()
+                          .lookup_resource_client(API::get<Sensor>())
+                          ->create_rpc_client(mock->name(), channel);
+
+        // The call is still in flight when the client which started it is destroyed.
+        std::future<ProtoStruct> readings =
+            std::dynamic_pointer_cast<Sensor>(client)->get_readings_async();
+        client.reset();
+        release.set_value();
+
+        BOOST_CHECK(readings.get().at("test") == fake_map().at("test"));
+    });
+}
+
 BOOST_AUTO_TEST_CASE(test_do_command) {
     std::shared_ptr<MockSensor> mock = MockSensor::get_mock_sensor();
     client_to_mock_pipeline<Sensor>(mock, [](Sensor& client) {
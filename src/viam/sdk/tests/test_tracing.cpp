@@ -0,0 +1,135 @@
+#define BOOST_TEST_MODULE test module test_tracing
+#include <boost/test/included/unit_test.hpp>
+
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#include <viam/sdk/tracing/private/sampling.hpp>
+
+namespace viam {
+namespace sdktests {
+
+using sdk::impl::MethodRateLimiter;
+using sdk::impl::tracing_options;
+
+namespace {
+
+// Sets environment variables for the duration of a test, unsetting them again afterwards.
+class scoped_env {
+   public:
+    ~scoped_env() {
+        for (const char* var : vars_) {
+            ::unsetenv(var);  // NOLINT(concurrency-mt-unsafe)
+        }
+    }
+
+    void set(const char* var, const char* value) {
+        ::setenv(var, value, 1);  // NOLINT(concurrency-mt-unsafe)
+        vars_.push_back(var);
+    }
+
+   private:
+    std::vector<const char*> vars_;
+};
+
+bool acquire(MethodRateLimiter& limiter,
+             const char* method,
+             MethodRateLimiter::clock::time_point now) {
+    return limiter.try_acquire(method, std::strlen(method), now);
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(test_tracing_options)
+
+BOOST_AUTO_TEST_CASE(test_defaults) {
+    const auto options = tracing_options::from_env();
+    BOOST_CHECK(options.sampler == tracing_options::sampler_kind::k_always_on);
+    BOOST_CHECK(!options.parent_based);
+    BOOST_CHECK_EQUAL(options.method_rate_limit, 0);
+    BOOST_CHECK_EQUAL(options.max_queue_size, 2048);
+    BOOST_CHECK_EQUAL(options.schedule_delay.count(), 5000);
+    BOOST_CHECK_EQUAL(options.max_export_batch_size, 512);
+}
+
+BOOST_AUTO_TEST_CASE(test_from_env) {
+    scoped_env env;
+    env.set("OTEL_TRACES_SAMPLER", "parentbased_traceidratio");
+    env.set("OTEL_TRACES_SAMPLER_ARG", "0.25");
+    env.set("VIAM_MODULE_TRACING_METHOD_RATE_LIMIT", "10");
+    env.set("OTEL_BSP_MAX_QUEUE_SIZE", "256");
+    env.set("OTEL_BSP_SCHEDULE_DELAY", "1000");
+    env.set("OTEL_BSP_MAX_EXPORT_BATCH_SIZE", "64");
+
+    const auto options = tracing_options::from_env();
+    BOOST_CHECK(options.sampler == tracing_options::sampler_kind::k_trace_id_ratio);
+    BOOST_CHECK(options.parent_based);
+    BOOST_CHECK_EQUAL(options.ratio, 0.25);
+    BOOST_CHECK_EQUAL(options.method_rate_limit, 10);
+    BOOST_CHECK_EQUAL(options.max_queue_size, 256);
+    BOOST_CHECK_EQUAL(options.schedule_delay.count(), 1000);
+    BOOST_CHECK_EQUAL(options.max_export_batch_size, 64);
+}
+
+BOOST_AUTO_TEST_CASE(test_invalid_values_are_ignored) {
+    scoped_env env;
+    env.set("OTEL_TRACES_SAMPLER", "sometimes");
+    env.set("OTEL_TRACES_SAMPLER_ARG", "1.5");
+    env.set("OTEL_BSP_MAX_QUEUE_SIZE", "-4");
+    env.set("OTEL_BSP_SCHEDULE_DELAY", "soon");
+
+    const auto options = tracing_options::from_env();
+    BOOST_CHECK(options.sampler == tracing_options::sampler_kind::k_always_on);
+    BOOST_CHECK(!options.parent_based);
+    BOOST_CHECK_EQUAL(options.ratio, 1.0);
+    BOOST_CHECK_EQUAL(options.max_queue_size, 2048);
+    BOOST_CHECK_EQUAL(options.schedule_delay.count(), 5000);
+}
+
+BOOST_AUTO_TEST_CASE(test_batch_fits_in_queue) {
+    scoped_env env;
+    env.set("OTEL_BSP_MAX_QUEUE_SIZE", "100");
+
+    const auto options = tracing_options::from_env();
+    BOOST_CHECK_EQUAL(options.max_export_batch_size, 100);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(test_method_rate_limiter)
+
+BOOST_AUTO_TEST_CASE(test_limits_each_method) {
+    MethodRateLimiter limiter(5);
+    const auto start = MethodRateLimiter::clock::now();
+
+    int motor = 0;
+    for (int i = 0; i < 100; ++i) {
+        motor += acquire(limiter, "MotorServer::GetPosition", start) ? 1 : 0;
+    }
+    BOOST_CHECK_EQUAL(motor, 5);
+
+    // Other methods have their own budget.
+    BOOST_CHECK(acquire(limiter, "EncoderServer::GetPosition", start));
+
+    // Tokens come back at the configured rate.
+    const auto later = start + std::chrono::milliseconds(400);
+    BOOST_CHECK(acquire(limiter, "MotorServer::GetPosition", later));
+    BOOST_CHECK(acquire(limiter, "MotorServer::GetPosition", later));
+    BOOST_CHECK(!acquire(limiter, "MotorServer::GetPosition", later));
+}
+
+BOOST_AUTO_TEST_CASE(test_fractional_rate) {
+    MethodRateLimiter limiter(0.5);
+    const auto start = MethodRateLimiter::clock::now();
+
+    BOOST_CHECK(acquire(limiter, "SensorServer::GetReadings", start));
+    BOOST_CHECK(!acquire(limiter, "SensorServer::GetReadings", start + std::chrono::seconds(1)));
+    BOOST_CHECK(acquire(limiter, "SensorServer::GetReadings", start + std::chrono::seconds(2)));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace sdktests
+}  // namespace viam
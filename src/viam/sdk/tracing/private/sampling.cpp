@@ -0,0 +1,121 @@
+#include <viam/sdk/tracing/private/sampling.hpp>
+
+#include <algorithm>
+#include <cstdlib>
+
+#include <boost/optional/optional.hpp>
+
+#include <viam/sdk/common/utils.hpp>
+#include <viam/sdk/log/logging.hpp>
+
+namespace viam {
+namespace sdk {
+namespace impl {
+
+namespace {
+
+boost::optional<double> env_double(const char* var, double min, double max) {
+    const auto value = get_env(var);
+    if (!value) {
+        return boost::none;
+    }
+    char* end = nullptr;
+    const double parsed = std::strtod(value->c_str(), &end);
+    if (value->empty() || *end != '\0' || !(parsed >= min && parsed <= max)) {
+        VIAM_SDK_LOG(warn) << "Ignoring invalid value `" << *value << "` for " << var;
+        return boost::none;
+    }
+    return parsed;
+}
+
+boost::optional<std::size_t> env_positive(const char* var) {
+    const auto value = get_env(var);
+    if (!value) {
+        return boost::none;
+    }
+    char* end = nullptr;
+    const unsigned long long parsed = std::strtoull(value->c_str(), &end, 10);
+    if (value->empty() || *end != '\0' || parsed == 0 || value->front() == '-') {
+        VIAM_SDK_LOG(warn) << "Ignoring invalid value `" << *value << "` for " << var;
+        return boost::none;
+    }
+    return static_cast<std::size_t>(parsed);
+}
+
+}  // namespace
+
+tracing_options tracing_options::from_env() {
+    tracing_options options;
+
+    if (const auto sampler = get_env("OTEL_TRACES_SAMPLER")) {
+        std::string name = *sampler;
+        const std::string parent_prefix = "parentbased_";
+        if (name.compare(0, parent_prefix.size(), parent_prefix) == 0) {
+            options.parent_based = true;
+            name.erase(0, parent_prefix.size());
+        }
+
+        if (name == "always_on") {
+            options.sampler = sampler_kind::k_always_on;
+        } else if (name == "always_off") {
+            options.sampler = sampler_kind::k_always_off;
+        } else if (name == "traceidratio") {
+            options.sampler = sampler_kind::k_trace_id_ratio;
+        } else {
+            VIAM_SDK_LOG(warn) << "Ignoring unknown OTEL_TRACES_SAMPLER `" << *sampler << "`";
+            options.parent_based = false;
+        }
+    }
+
+    if (const auto ratio = env_double("OTEL_TRACES_SAMPLER_ARG", 0, 1)) {
+        options.ratio = *ratio;
+    }
+    if (const auto limit = env_double("VIAM_MODULE_TRACING_METHOD_RATE_LIMIT", 0, 1e9)) {
+        options.method_rate_limit = *limit;
+    }
+
+    if (const auto size = env_positive("OTEL_BSP_MAX_QUEUE_SIZE")) {
+        options.max_queue_size = *size;
+    }
+    if (const auto delay = env_positive("OTEL_BSP_SCHEDULE_DELAY")) {
+        options.schedule_delay = std::chrono::milliseconds(*delay);
+    }
+    if (const auto size = env_positive("OTEL_BSP_MAX_EXPORT_BATCH_SIZE")) {
+        options.max_export_batch_size = *size;
+    }
+    // The batch processor requires that a batch fit in the queue.
+    options.max_export_batch_size = std::min(options.max_export_batch_size, options.max_queue_size);
+
+    return options;
+}
+
+MethodRateLimiter::MethodRateLimiter(double per_second)
+    : per_second_(per_second), capacity_(std::max(per_second, 1.0)) {}
+
+bool MethodRateLimiter::try_acquire(const char* method,
+                                    std::size_t length,
+                                    clock::time_point now) {
+    // Reusing one key per thread avoids allocating a string for each lookup.
+    thread_local std::string key;
+    key.assign(method, length);
+
+    const std::lock_guard<std::mutex> guard(lock_);
+    auto it = buckets_.find(key);
+    if (it == buckets_.end()) {
+        it = buckets_.emplace(key, bucket{capacity_, now}).first;
+    }
+
+    bucket& b = it->second;
+    const std::chrono::duration<double> elapsed = now - b.refilled;
+    b.tokens = std::min(capacity_, b.tokens + elapsed.count() * per_second_);
+    b.refilled = now;
+    if (b.tokens < 1) {
+        return false;
+    }
+    b.tokens -= 1;
+    return true;
+}
+
+}  // namespace impl
+}  // namespace sdk
+}  // namespace viam
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace viam {
+namespace sdk {
+namespace impl {
+
+/// @brief How module tracing samples spans and batches them for export to the parent.
+///
+/// The defaults keep every span and use the OpenTelemetry batch processor defaults. Use
+/// @c from_env to apply the standard OpenTelemetry environment variables, and
+/// @c VIAM_MODULE_TRACING_METHOD_RATE_LIMIT for a per-method limit.
+struct tracing_options {
+    enum class sampler_kind { k_always_on, k_always_off, k_trace_id_ratio };
+
+    /// @brief The sampler for spans without a parent, or for all spans if not @c parent_based.
+    sampler_kind sampler = sampler_kind::k_always_on;
+
+    /// @brief Whether spans with a remote parent follow the parent's sampling decision.
+    bool parent_based = false;
+
+    /// @brief The fraction of traces kept by @c k_trace_id_ratio, between 0 and 1.
+    double ratio = 1.0;
+
+    /// @brief The most spans per second kept for any one method, after sampling. Zero is no limit.
+    double method_rate_limit = 0;
+
+    std::size_t max_queue_size = 2048;
+    std::chrono::milliseconds schedule_delay{5000};
+    std::size_t max_export_batch_size = 512;
+
+    /// @brief Read the options from the environment, falling back to the defaults above for
+    /// anything unset or invalid:
+    ///
+    /// - @c OTEL_TRACES_SAMPLER: one of @c always_on, @c always_off, @c traceidratio,
+    ///   @c parentbased_always_on, @c parentbased_always_off or @c parentbased_traceidratio.
+    /// - @c OTEL_TRACES_SAMPLER_ARG: the ratio for the @c traceidratio samplers.
+    /// - @c OTEL_BSP_MAX_QUEUE_SIZE, @c OTEL_BSP_SCHEDULE_DELAY (milliseconds) and
+    ///   @c OTEL_BSP_MAX_EXPORT_BATCH_SIZE.
+    /// - @c VIAM_MODULE_TRACING_METHOD_RATE_LIMIT: spans per second per method.
+    static tracing_options from_env();
+};
+
+/// @brief A token bucket per method name, limiting how many spans each method records per second.
+/// Each bucket holds up to one second's worth of tokens, and at least one, so short bursts are
+/// allowed.
+class MethodRateLimiter {
+   public:
+    using clock = std::chrono::steady_clock;
+
+    explicit MethodRateLimiter(double per_second);
+
+    /// @brief Take a token from the bucket for @p method, returning false if it is empty.
+    bool try_acquire(const char* method, std::size_t length, clock::time_point now = clock::now());
+
+   private:
+    struct bucket {
+        double tokens;
+        clock::time_point refilled;
+    };
+
+    const double per_second_;
+    const double capacity_;
+    std::mutex lock_;
+    std::unordered_map<std::string, bucket> buckets_;
+};
+
+}  // namespace impl
+}  // namespace sdk
+}  // namespace viam
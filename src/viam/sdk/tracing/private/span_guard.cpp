@@ -5,6 +5,7 @@
 
 #ifdef VIAMCPPSDK_OPENTELEMETRY_TRACING
 
+#include <cstdint>
 #include <utility>
 
 #include <opentelemetry/common/attribute_value.h>
@@ -19,6 +20,8 @@
 #include <opentelemetry/trace/span_startoptions.h>
 #include <opentelemetry/trace/tracer.h>
 
+#include <viam/sdk/tracing/private/tracer.hpp>
+
 namespace otel_ctx = opentelemetry::context;
 namespace otel_prop = opentelemetry::context::propagation;
 namespace otel_trace = opentelemetry::trace;
@@ -30,6 +33,24 @@ namespace impl {
 namespace {
 
 constexpr const char* k_instrumentation_scope = "viam-cpp-sdk";
+constexpr const char* k_traceparent = "traceparent";
+
+// The tracer of the installed provider, fetched once per thread and provider rather than on each
+// request.
+otel_trace::Tracer* cached_tracer(std::uint64_t generation) noexcept {
+    thread_local std::uint64_t cached_generation = 0;
+    thread_local opentelemetry::nostd::shared_ptr<otel_trace::Tracer> tracer;
+    if (cached_generation != generation) {
+        tracer = otel_trace::Provider::GetTracerProvider()->GetTracer(k_instrumentation_scope);
+        cached_generation = generation;
+    }
+    return tracer.get();
+}
+
+bool has_traceparent(const grpc::ServerContext& ctx) noexcept {
+    const auto& metadata = ctx.client_metadata();
+    return metadata.find(grpc::string_ref{k_traceparent}) != metadata.end();
+}
 
 // Carrier for reading W3C trace context from incoming gRPC request metadata (server side).
 class GrpcServerCarrier : public otel_prop::TextMapCarrier {
@@ -76,12 +97,16 @@ class GrpcClientCarrier : public otel_prop::TextMapCarrier {
 
 opentelemetry::nostd::shared_ptr<otel_trace::Span> ServerSpanGuard::start_span_(
     const GrpcServerContext* ctx, const char* method) noexcept {
-    auto tracer = otel_trace::Provider::GetTracerProvider()->GetTracer(k_instrumentation_scope);
+    const std::uint64_t generation = Tracer::active_generation();
+    if (generation == 0) {
+        return {};
+    }
 
     otel_trace::StartSpanOptions opts;
     opts.kind = otel_trace::SpanKind::kServer;
 
-    if (ctx) {
+    // Without a traceparent header there is nothing to extract, and the span is a new root.
+    if (ctx && has_traceparent(*ctx)) {
         GrpcServerCarrier carrier{*ctx};
         auto current_ctx = otel_ctx::RuntimeContext::GetCurrent();
         const auto extracted = otel_prop::GlobalTextMapPropagator::GetGlobalPropagator()->Extract(
@@ -89,16 +114,30 @@ opentelemetry::nostd::shared_ptr<otel_trace::Span> ServerSpanGuard::start_span_(
         opts.parent = otel_trace::GetSpan(extracted)->GetContext();
     }
 
-    auto span = tracer->StartSpan(method, opts);
-    span->SetAttribute("rpc.system", "grpc");
+    auto span = cached_tracer(generation)->StartSpan(method, opts);
+    if (span->IsRecording()) {
+        span->SetAttribute("rpc.system", "grpc");
+    }
     return span;
 }
 
-// Constructing `scope_` makes the span active on the current thread.
 ServerSpanGuard::ServerSpanGuard(const GrpcServerContext* ctx, const char* method) noexcept
-    : span_(start_span_(ctx, method)), scope_(span_) {}
+    : span_(start_span_(ctx, method)) {
+    activate_();
+}
+
+void ServerSpanGuard::activate_() noexcept {
+    // A span which is not recording still carries the trace context, which downstream calls made
+    // by the handler must propagate, so it is made active as well.
+    if (span_) {
+        scope_.emplace(span_);
+    }
+}
 
 ServerSpanGuard::~ServerSpanGuard() noexcept {
+    if (!span_) {
+        return;
+    }
     if (!committed_) {
         span_->SetStatus(otel_trace::StatusCode::kError, "handler threw an exception");
     }
@@ -107,6 +146,9 @@ ServerSpanGuard::~ServerSpanGuard() noexcept {
 
 ::grpc::Status ServerSpanGuard::commit(::grpc::Status status) noexcept {
     committed_ = true;
+    if (!span_) {
+        return status;
+    }
     if (status.error_code() == ::grpc::StatusCode::OK) {
         span_->SetStatus(otel_trace::StatusCode::kOk);
     } else {
@@ -134,11 +176,17 @@ void record_unknown_exception(otel_trace::Span* span) noexcept {
 
 void ServerSpanGuard::record_exception(const std::exception& xcp) noexcept {
     committed_ = true;
+    if (!span_) {
+        return;
+    }
     impl::record_exception(span_.get(), xcp);
 }
 
 void ServerSpanGuard::record_unknown_exception() noexcept {
     committed_ = true;
+    if (!span_) {
+        return;
+    }
     impl::record_unknown_exception(span_.get());
 }
 
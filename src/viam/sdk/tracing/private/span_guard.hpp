@@ -7,6 +7,8 @@
 #include <viam/sdk/common/grpc_fwd.hpp>
 
 #ifdef VIAMCPPSDK_OPENTELEMETRY_TRACING
+#include <boost/optional/optional.hpp>
+
 #include <opentelemetry/trace/scope.h>
 #include <opentelemetry/trace/span.h>
 #endif
@@ -21,7 +23,8 @@ namespace impl {
 /// destroyed, ends the span and records the final gRPC status.
 ///
 /// If OpenTelemetry tracing is not compiled in, or no tracer provider has been configured,
-/// uses a no-op implementation.
+/// uses a no-op implementation. A span which sampling drops is still made active, so that its
+/// trace context reaches the calls the handler makes, but no attributes are recorded on it.
 ///
 /// @note Instances must be created and destroyed on the same thread (the gRPC handler thread).
 class ServerSpanGuard {
@@ -43,12 +46,15 @@ class ServerSpanGuard {
 
 #ifdef VIAMCPPSDK_OPENTELEMETRY_TRACING
    private:
-    // Builds the span and makes it active; runs before `scope_` in the constructor init list.
+    // Builds the span, or returns null if no tracer provider is installed.
     static opentelemetry::nostd::shared_ptr<opentelemetry::trace::Span> start_span_(
         const GrpcServerContext* ctx, const char* method) noexcept;
 
+    // Makes the span active on the current thread, if a tracer provider is installed.
+    void activate_() noexcept;
+
     opentelemetry::nostd::shared_ptr<opentelemetry::trace::Span> span_;
-    opentelemetry::trace::Scope scope_;
+    boost::optional<opentelemetry::trace::Scope> scope_;
     bool committed_ = false;
 #endif
 };
@@ -8,6 +8,7 @@
 
 #include <atomic>
 #include <chrono>
+#include <cstdint>
 #include <memory>
 #include <utility>
 
@@ -21,6 +22,11 @@
 #include <opentelemetry/sdk/trace/batch_span_processor_options.h>
 #include <opentelemetry/sdk/trace/exporter.h>
 #include <opentelemetry/sdk/trace/recordable.h>
+#include <opentelemetry/sdk/trace/sampler.h>
+#include <opentelemetry/sdk/trace/samplers/always_off_factory.h>
+#include <opentelemetry/sdk/trace/samplers/always_on_factory.h>
+#include <opentelemetry/sdk/trace/samplers/parent_factory.h>
+#include <opentelemetry/sdk/trace/samplers/trace_id_ratio_factory.h>
 #include <opentelemetry/sdk/trace/tracer_provider.h>
 #include <opentelemetry/sdk/trace/tracer_provider_factory.h>
 #include <opentelemetry/trace/noop.h>
@@ -29,6 +35,7 @@
 
 #include <viam/api/robot/v1/robot.pb.h>
 #include <viam/sdk/robot/client.hpp>
+#include <viam/sdk/tracing/private/sampling.hpp>
 
 namespace otel_common = opentelemetry::sdk::common;
 namespace otel_prop = opentelemetry::context::propagation;
@@ -45,6 +52,70 @@ namespace {
 
 constexpr const char* k_instrumentation_scope = "viam-cpp-sdk";
 
+// See Tracer::active_generation.
+std::atomic<std::uint64_t> current_generation{0};
+std::atomic<std::uint64_t> last_generation{0};
+
+// Drops the spans of any method which `delegate` would sample more often than a rate limit allows,
+// so that high frequency RPCs such as motor and encoder polls do not crowd out everything else.
+class MethodRateLimitingSampler final : public otel_sdk_trace::Sampler {
+   public:
+    MethodRateLimitingSampler(std::unique_ptr<otel_sdk_trace::Sampler> delegate,
+                              double per_second)
+        : delegate_(std::move(delegate)), limiter_(per_second) {}
+
+    otel_sdk_trace::SamplingResult ShouldSample(
+        const otel_trace::SpanContext& parent_context,
+        otel_trace::TraceId trace_id,
+        opentelemetry::nostd::string_view name,
+        otel_trace::SpanKind span_kind,
+        const opentelemetry::common::KeyValueIterable& attributes,
+        const otel_trace::SpanContextKeyValueIterable& links) noexcept override {
+        auto result =
+            delegate_->ShouldSample(parent_context, trace_id, name, span_kind, attributes, links);
+        if (result.IsRecording() && !limiter_.try_acquire(name.data(), name.size())) {
+            return {otel_sdk_trace::Decision::DROP, nullptr, result.trace_state};
+        }
+        return result;
+    }
+
+    opentelemetry::nostd::string_view GetDescription() const noexcept override {
+        return "MethodRateLimitingSampler";
+    }
+
+   private:
+    std::unique_ptr<otel_sdk_trace::Sampler> delegate_;
+    MethodRateLimiter limiter_;
+};
+
+std::unique_ptr<otel_sdk_trace::Sampler> make_sampler(const tracing_options& options) {
+    std::unique_ptr<otel_sdk_trace::Sampler> sampler;
+    switch (options.sampler) {
+        case tracing_options::sampler_kind::k_always_off:
+            sampler = otel_sdk_trace::AlwaysOffSamplerFactory::Create();
+            break;
+        case tracing_options::sampler_kind::k_trace_id_ratio:
+            sampler = otel_sdk_trace::TraceIdRatioBasedSamplerFactory::Create(options.ratio);
+            break;
+        case tracing_options::sampler_kind::k_always_on:
+        default:
+            sampler = otel_sdk_trace::AlwaysOnSamplerFactory::Create();
+            break;
+    }
+
+    if (options.parent_based) {
+        sampler = otel_sdk_trace::ParentBasedSamplerFactory::Create(
+            std::shared_ptr<otel_sdk_trace::Sampler>(std::move(sampler)));
+    }
+
+    if (options.method_rate_limit > 0) {
+        sampler = std::unique_ptr<otel_sdk_trace::Sampler>(
+            new MethodRateLimitingSampler(std::move(sampler), options.method_rate_limit));
+    }
+
+    return sampler;
+}
+
 }  // namespace
 
 // Ships OTLP-encoded spans to the parent process via RobotClient::send_traces.
@@ -90,6 +161,28 @@ class ParentSendTracesExporter final : public otel_sdk_trace::SpanExporter {
     std::atomic<bool> is_shutdown_{false};
 };
 
+// Encodes spans as ParentSendTracesExporter would, then drops them.
+class DiscardingExporter final : public otel_sdk_trace::SpanExporter {
+   public:
+    std::unique_ptr<otel_sdk_trace::Recordable> MakeRecordable() noexcept override {
+        return std::unique_ptr<otel_sdk_trace::Recordable>(new otel_otlp::OtlpRecordable());
+    }
+
+    otel_common::ExportResult Export(
+        const opentelemetry::nostd::span<std::unique_ptr<otel_sdk_trace::Recordable>>&) noexcept
+        override {
+        return otel_common::ExportResult::kSuccess;
+    }
+
+    bool ForceFlush(std::chrono::microseconds /*timeout*/) noexcept override {
+        return true;
+    }
+
+    bool Shutdown(std::chrono::microseconds /*timeout*/) noexcept override {
+        return true;
+    }
+};
+
 void Tracer::initialize_propagator() noexcept {
     otel_prop::GlobalTextMapPropagator::SetGlobalPropagator(
         opentelemetry::nostd::shared_ptr<otel_prop::TextMapPropagator>(
@@ -105,6 +198,10 @@ Tracer& Tracer::get() {
     return Instance::current(Instance::Creation::open_existing).impl_->tracer;
 }
 
+std::uint64_t Tracer::active_generation() noexcept {
+    return current_generation.load(std::memory_order_acquire);
+}
+
 void Tracer::initialize_provider(RobotClient* client) noexcept {
     shutdown_provider();
 
@@ -112,28 +209,45 @@ void Tracer::initialize_provider(RobotClient* client) noexcept {
         return;
     }
 
-    auto exporter =
-        std::unique_ptr<otel_sdk_trace::SpanExporter>(new ParentSendTracesExporter(client));
+    install_(std::unique_ptr<otel_sdk_trace::SpanExporter>(new ParentSendTracesExporter(client)));
+}
+
+void Tracer::initialize_discarding_provider() noexcept {
+    shutdown_provider();
+    install_(std::unique_ptr<otel_sdk_trace::SpanExporter>(new DiscardingExporter()));
+}
 
-    auto processor = otel_sdk_trace::BatchSpanProcessorFactory::Create(
-        std::move(exporter), otel_sdk_trace::BatchSpanProcessorOptions{});
+void Tracer::install_(std::unique_ptr<otel_sdk_trace::SpanExporter> exporter) noexcept {
+    const auto options = tracing_options::from_env();
+
+    otel_sdk_trace::BatchSpanProcessorOptions batch_options;
+    batch_options.max_queue_size = options.max_queue_size;
+    batch_options.schedule_delay_millis = options.schedule_delay;
+    batch_options.max_export_batch_size = options.max_export_batch_size;
+
+    auto processor =
+        otel_sdk_trace::BatchSpanProcessorFactory::Create(std::move(exporter), batch_options);
 
     auto resource = otel_sdk_resource::Resource::Create({
         {"service.name", std::string{k_instrumentation_scope}},
     });
 
     sdk_provider_ = std::shared_ptr<otel_sdk_trace::TracerProvider>(
-        otel_sdk_trace::TracerProviderFactory::Create(std::move(processor), resource));
+        otel_sdk_trace::TracerProviderFactory::Create(
+            std::move(processor), resource, make_sampler(options)));
 
     std::shared_ptr<otel_trace::TracerProvider> base_provider = sdk_provider_;
     otel_trace::Provider::SetTracerProvider(
         opentelemetry::nostd::shared_ptr<otel_trace::TracerProvider>(std::move(base_provider)));
+
+    current_generation.store(last_generation.fetch_add(1) + 1, std::memory_order_release);
 }
 
 void Tracer::shutdown_provider() noexcept {
     if (!sdk_provider_) {
         return;
     }
+    current_generation.store(0, std::memory_order_release);
     sdk_provider_->Shutdown();
     otel_trace::Provider::SetTracerProvider(
         opentelemetry::nostd::shared_ptr<otel_trace::TracerProvider>(
@@ -164,8 +278,13 @@ Tracer& Tracer::get() {
 }
 
 void Tracer::initialize_provider(RobotClient*) noexcept {}
+void Tracer::initialize_discarding_provider() noexcept {}
 void Tracer::shutdown_provider() noexcept {}
 
+std::uint64_t Tracer::active_generation() noexcept {
+    return 0;
+}
+
 }  // namespace impl
 }  // namespace sdk
 }  // namespace viam
@@ -1,8 +1,11 @@
 #pragma once
 
+#include <cstdint>
+
 #ifdef VIAMCPPSDK_OPENTELEMETRY_TRACING
 #include <memory>
 
+#include <opentelemetry/sdk/trace/exporter.h>
 #include <opentelemetry/sdk/trace/tracer_provider.h>
 #endif
 
@@ -33,10 +36,22 @@ class Tracer {
     /// @brief Install an exporter sourced from @p client. The caller must keep @p client alive
     /// until @c shutdown_provider returns.
     void initialize_provider(RobotClient* client) noexcept;
+
+    /// @brief Install a provider which records spans as usual but discards them on export. For
+    /// measuring the cost of tracing itself.
+    void initialize_discarding_provider() noexcept;
+
     void shutdown_provider() noexcept;
 
+    /// @brief Zero while no provider is installed. Otherwise nonzero, and different for each
+    /// provider installed, so that a tracer obtained from the global provider can be cached until
+    /// this changes.
+    static std::uint64_t active_generation() noexcept;
+
 #ifdef VIAMCPPSDK_OPENTELEMETRY_TRACING
    private:
+    void install_(std::unique_ptr<opentelemetry::sdk::trace::SpanExporter> exporter) noexcept;
+
     std::shared_ptr<opentelemetry::sdk::trace::TracerProvider> sdk_provider_;
 #endif
 };